@@ -0,0 +1,174 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcache.h 
+ 
+  Synopsis: 
+    Definitions of the TAL capability cache, which lets nx_Open skip the 
+    capability probe for targets it has seen before, and of the open 
+    latency instrumentation 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxcache_h_ 
+#define _nxcache_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+ 
+/* version string for v1.0 of the cache file layout 
+*/ 
+#define NXC_VERSION_STRING_10 "nxCachev1.0" 
+ 
+ 
+/* NX_NRR_DEVICE_ID: index of the Device ID NRR (see Appendix B), the only 
+    register read when validating a cached entry 
+*/ 
+#define NX_NRR_DEVICE_ID (0) 
+ 
+/* NX_NUM_NRR: number of NRR indexes, see nxhal_ReadNRR 
+*/ 
+#define NX_NUM_NRR (128) 
+ 
+/* NXC_ALL_DEVICES: matches every entry, see nx_InvalidateCapabilityCache 
+*/ 
+#define NXC_ALL_DEVICES (-1) 
+ 
+/* NXC_MAX_STRING: room for each string of a cache entry, NUL included 
+*/ 
+#define NXC_MAX_STRING (256) 
+ 
+ 
+/* +-------------+ 
+   | cache types | 
+   +-------------+ */ 
+ 
+/* nxt_NRRLayout: the width of each NRR as discovered by the probe 
+    - numBits == 0 if the register is not implemented 
+*/ 
+typedef struct { 
+  int numBits[NX_NUM_NRR]; 
+} nxt_NRRLayout; 
+ 
+ 
+/* nxt_CacheEntry: what is persisted for one target 
+    - every field of nxt_Capability is stored by value; the strings are 
+        restored as pointers owned by the handle 
+    - an entry is keyed by deviceId and the whole of halInfo, compared 
+        exactly 
+    - a target whose apiVersionString or halInfo does not fit in 
+        NXC_MAX_STRING is never stored: nx_Open probes it every time 
+        rather than truncate the key and risk a match with another HAL 
+*/ 
+typedef struct { 
+  char apiVersionString[NXC_MAX_STRING]; 
+  char halInfo[NXC_MAX_STRING]; 
+  nxt_Endian targetEndian; 
+  nxt_Endian emuEndian; 
+  int deviceId; 
+  int maxMemMap; 
+  int maxMemAccessPriority; 
+  int maxAccessSize; 
+  int btmEventId; 
+  int dtmMinEventId; 
+  int dtmMaxEventId; 
+  int otmEventId; 
+  int substitutionEventId; 
+  int watchMinEventId; 
+  int watchMaxEventId; 
+  int breakMinEventId; 
+  int breakMaxEventId; 
+  nxt_NRRLayout nrr; 
+} nxt_CacheEntry; 
+ 
+ 
+/* nxt_OpenStats: instrumentation recorded by the last open of a handle 
+    - times are wall clock microseconds 
+*/ 
+typedef struct { 
+  int warm;                  /* != 0 if the capabilities came from the cache */ 
+  long halOpenMicros;        /* time spent in nxhal_Open */ 
+  long validateMicros;       /* time spent checking the cached entry */ 
+  long probeMicros;          /* time spent probing, 0 when warm */ 
+  long totalMicros;          /* whole of nx_Open */ 
+  int numNRRReads;           /* NRR reads issued during the open */ 
+  int uncacheable;           /* != 0 if the target's strings were too long */ 
+} nxt_OpenStats; 
+ 
+ 
+/* +-------------------------------------------------------+ 
+   | nx_SetCapabilityCache() - Select the Cache to be Used | 
+   +-------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - path names the cache file; NULL disables the cache 
+ 
+   Postconditions: 
+     if succeeds, later calls of nx_Open in this process look the target up 
+       in the cache and returns NX_ERROR_NONE; the file is created when 
+       the first entry is stored 
+     else returns NX_ERROR_FAILED and the cache is disabled 
+ 
+   Notes: 
+     On open the TAL reads NX_NRR_DEVICE_ID only.  If an entry exists for 
+     that deviceId and the halInfo reported by nxhal_Open, cap and the NRR 
+     layout are taken from it and the probe sequence is skipped; nothing 
+     else is checked, so a target reconfigured without a change of either 
+     must be dropped with nx_InvalidateCapabilityCache.  Otherwise the 
+     target is probed as usual and a new entry added; entries for other 
+     keys, including the same deviceId under another halInfo, are kept. 
+     To add or remove entries the TAL takes an exclusive lock on a file 
+     named path with ".lock" appended, reads the cache again, writes it 
+     whole to a temporary name and renames it over path, then releases 
+     the lock.  Concurrent updates from several processes are thus applied 
+     one after the other and none is lost, and lookups, which take no 
+     lock, never see a partial file. 
+*/ 
+ 
+nxt_Status nx_SetCapabilityCache (const char *path); 
+ 
+ 
+/* +--------------------------------------------------------+ 
+   | nx_InvalidateCapabilityCache() - Forget Cached Targets | 
+   +--------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - deviceId is the device to forget, or NXC_ALL_DEVICES to forget 
+         every entry 
+ 
+   Postconditions: 
+     - the matching entries are removed and the next nx_Open of those 
+         devices probes the target 
+     - returned status indicates whether the cache file could be updated 
+*/ 
+ 
+nxt_Status nx_InvalidateCapabilityCache (const int deviceId); 
+ 
+ 
+/* +-----------------------------------------------+ 
+   | nx_GetOpenStats() - Read the Open Latency     | 
+   +-----------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - stats points to where the statistics will be stored 
+ 
+   Postconditions: 
+     - stats holds the figures of the nx_Open that created handle, 
+         and NX_ERROR_NONE is returned 
+*/ 
+ 
+nxt_Status nx_GetOpenStats (nxt_Handle *handle, nxt_OpenStats *stats); 
+ 
+#endif /* _nxcache_h_ */
@@ -0,0 +1,290 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec.h 
+ 
+  Synopsis: 
+    Definitions of the codecs for nxt_Packet and NRR data: the auxiliary 
+    port (MDO/MSEO) encoder and decoder and the NRR image packer, each 
+    with the scalar reference that optimised versions must agree with 
+    (see src/ and, for the harness checking them, tests/) 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxcodec_h_ 
+#define _nxcodec_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+/* size_t 
+*/ 
+#include <stddef.h> 
+ 
+ 
+/* +-------------+ 
+   | codec types | 
+   +-------------+ */ 
+ 
+/* NX_BYTES_IN_BITS: bytes holding n bits, as for nxt_Packet.data and the 
+    data of nxhal_ReadNRR/nxhal_WriteNRR 
+*/ 
+#define NX_BYTES_IN_BITS(n) (((n)+7)/8) 
+ 
+/* Bit order of nxt_Packet.data and of NRR data: 
+    - bit i is bit (i % 8) of byte (i / 8), i.e. least significant first, 
+        which is the order bits are shifted through MDO and TDI/TDO 
+    - the bits of the last byte above bit (n-1) % 8 are zero on output 
+        from every codec, and are ignored on input 
+*/ 
+ 
+ 
+/* NX_TCODE_BITS: width of the TCODE packet, the first of every message 
+*/ 
+#define NX_TCODE_BITS (6) 
+ 
+/* NX_NUM_TCODES: number of TCODE values 
+*/ 
+#define NX_NUM_TCODES (64) 
+ 
+/* NX_MAX_PACKETS: most packets in a message, the TCODE included 
+*/ 
+#define NX_MAX_PACKETS (16) 
+ 
+ 
+/* nxt_MessageLayout: the packets of the messages with one TCODE 
+    - numPackets counts the TCODE packet; 0 if the TCODE is not used, in 
+        which case messages with it are malformed 
+    - numBits[i] > 0 for a fixed length packet of that many bits, 0 for 
+        a variable length packet; numBits[0] is ignored, the TCODE being 
+        NX_TCODE_BITS wide 
+*/ 
+typedef struct { 
+  int numPackets; 
+  int numBits[NX_MAX_PACKETS]; 
+} nxt_MessageLayout; 
+ 
+ 
+/* nxt_PacketLayout: the message layouts of a target, indexed by TCODE 
+    - the AUX port only marks the end of variable length packets, so a 
+        message can only be split into packets with its layout, which 
+        is given by the target's documentation (see Appendix B) 
+*/ 
+typedef struct { 
+  nxt_MessageLayout tcode[NX_NUM_TCODES]; 
+} nxt_PacketLayout; 
+ 
+ 
+/* nxt_MSEO: the message start/end out code sent with each MDO transfer 
+*/ 
+typedef enum { 
+  NX_MSEO_NORMAL      = 0x0,  /* packet data continues */ 
+  NX_MSEO_END_PACKET  = 0x1,  /* last transfer of a variable length packet */ 
+                              /*   other than the last of its message */ 
+  NX_MSEO_END_MESSAGE = 0x3   /* last transfer of a message */ 
+} nxt_MSEO; 
+ 
+ 
+/* nxt_AuxStream: a capture of the auxiliary output port, being decoded 
+    - transfer n is mdo[n], in its low mdoBits bits, sent with mseo[n], 
+        an nxt_MSEO; a port with a single MSEO pin sends each code over 
+        two clocks, which the capture has already folded into one, and 
+        idle clocks are not captured 
+    - pos is the index of the next transfer to be decoded 
+    - numMalformed counts the messages the decoder has skipped 
+*/ 
+typedef struct { 
+  int mdoBits;                 /* 1, 2, 4, 6, 8, 12 or 16 */ 
+  const unsigned short *mdo; 
+  const unsigned char *mseo; 
+  size_t numTransfers; 
+  size_t pos; 
+  size_t numMalformed; 
+} nxt_AuxStream; 
+ 
+ 
+/* nxt_AuxBuffer: where the encoder stores transfers 
+    - mdo and mseo point to room for maxTransfers transfers each; 
+        numTransfers is updated by the encoder 
+*/ 
+typedef struct { 
+  int mdoBits;                 /* as for nxt_AuxStream */ 
+  unsigned short *mdo; 
+  unsigned char *mseo; 
+  size_t maxTransfers; 
+  size_t numTransfers; 
+} nxt_AuxBuffer; 
+ 
+ 
+/* Message format on the AUX port: 
+    - the bits of a message's packets are sent one after the other, in 
+        the bit order above, mdoBits to a transfer; the TCODE packet comes 
+        first and selects the layout 
+    - a variable length packet holds at least one bit and runs to the end 
+        of a transfer, the bits it does not need being zero; that transfer 
+        is marked NX_MSEO_END_PACKET, or NX_MSEO_END_MESSAGE if the packet 
+        is the last of the message 
+    - after a fixed length last packet the rest of the transfer is zero 
+        and the transfer is marked NX_MSEO_END_MESSAGE 
+    - every other transfer is marked NX_MSEO_NORMAL 
+   A message is thus the transfers from pos up to the first marked 
+   NX_MSEO_END_MESSAGE.  It is malformed if its TCODE is not used, if an 
+   mseo value is not an nxt_MSEO, or if its packets, taken in turn as the 
+   layout says, do not end exactly as the rules above require. 
+*/ 
+ 
+ 
+/* nxt_MessageArena: where decoded messages are stored 
+    - messages, packets and data are filled from the front; the used 
+        counts are updated by the decoder 
+*/ 
+typedef struct { 
+  nxt_Message *messages; 
+  int maxMessages; 
+  int numMessages; 
+  nxt_Packet *packets; 
+  int maxPackets; 
+  int numPackets; 
+  unsigned char *data; 
+  size_t maxData; 
+  size_t numData; 
+} nxt_MessageArena; 
+ 
+ 
+/* +-----------------------------------------------------+ 
+   | nx_DecodeAux() - Decode Messages from an AUX Stream | 
+   +-----------------------------------------------------+ 
+ 
+   Preconditions: 
+     - layout gives the message layouts of the target 
+     - stream holds the transfers to decode, from stream->pos on 
+     - arena is where the messages will be stored 
+ 
+   Postconditions: 
+     - every message in the stream is, in turn, skipped and counted in 
+         stream->numMalformed if it is malformed, or else stored in the 
+         arena; stream->pos is moved past it 
+     - a message without its NX_MSEO_END_MESSAGE transfer is left for the 
+         next call 
+     - returns NX_ERROR_NONE, NX_ERROR_NO_SPACE if the next message does 
+         not fit in the arena (stream->pos is then at its start), or 
+         NX_ERROR_FAILED, with nothing done, if mdoBits is not allowed 
+ 
+   Notes: 
+     A variable length packet is decoded with all the bits up to the end 
+     of its transfer, so its numBitsInPacket is the one it was sent with 
+     rounded up to that boundary, the bits added being zero. 
+     nx_DecodeAux is optimised (SIMD scan of the MSEO codes, word at a 
+     time extraction of the MDO bits); nx_DecodeAuxRef is the plain 
+     scalar reference, one bit at a time.  For any input, including 
+     malformed ones, both return the same status, stop at the same pos, 
+     count the same malformed messages and fill the arena byte for byte 
+     the same. 
+*/ 
+ 
+nxt_Status nx_DecodeAux (const nxt_PacketLayout *layout, 
+                         nxt_AuxStream *stream, nxt_MessageArena *arena); 
+ 
+nxt_Status nx_DecodeAuxRef (const nxt_PacketLayout *layout, 
+                            nxt_AuxStream *stream, nxt_MessageArena *arena); 
+ 
+ 
+/* +---------------------------------------------------+ 
+   | nx_EncodeAux() - Encode Messages as AUX Transfers | 
+   +---------------------------------------------------+ 
+ 
+   Preconditions: 
+     - layout gives the message layouts of the target 
+     - messages points to numMessages messages 
+     - buffer is where the transfers will be stored, after those it 
+         already holds 
+     - numEncoded points to where the number of messages encoded will 
+         be stored 
+ 
+   Postconditions: 
+     - returns NX_ERROR_NONE once every message is encoded 
+     - returns NX_ERROR_FAILED at the first message that does not match 
+         its layout: a TCODE packet of other than NX_TCODE_BITS bits, 
+         another number of packets, a fixed length packet of another 
+         width, or an empty variable length packet; or with nothing done, 
+         if mdoBits is not allowed 
+     - returns NX_ERROR_NO_SPACE at the first message that does not fit 
+     - in each case buffer->numTransfers ends after the last message 
+         encoded 
+ 
+   Notes: 
+     Decoding the output gives back the messages, with variable length 
+     packets rounded up as nx_DecodeAux says; encoding those again gives 
+     the same transfers.  nx_EncodeAuxRef is the scalar reference, and 
+     both give the same output for any input. 
+*/ 
+ 
+nxt_Status nx_EncodeAux (const nxt_PacketLayout *layout, 
+                         const nxt_Message *messages, const int numMessages, 
+                         nxt_AuxBuffer *buffer, int *numEncoded); 
+ 
+nxt_Status nx_EncodeAuxRef (const nxt_PacketLayout *layout, 
+                            const nxt_Message *messages, 
+                            const int numMessages, 
+                            nxt_AuxBuffer *buffer, int *numEncoded); 
+ 
+ 
+/* +---------------------------------------------------+ 
+   | nx_PackNRR() - Build an NRR Image from its Fields | 
+   +---------------------------------------------------+ 
+ 
+   Preconditions: 
+     - fields points to numFields values, least significant field first 
+     - widths points to the width in bits of each field, 1 to 64 
+     - data points to NX_BYTES_IN_BITS of the sum of widths bytes 
+ 
+   Postconditions: 
+     - data holds the register image as passed to nxhal_WriteNRR; bits of 
+         a value above its width are ignored 
+ 
+   Notes: 
+     nx_PackNRR works a word at a time, nx_PackNRRRef one bit at a time; 
+     both give the same image. 
+*/ 
+ 
+void nx_PackNRR (const nxvt_Word *fields, const int *widths, 
+                 const int numFields, void *data); 
+ 
+void nx_PackNRRRef (const nxvt_Word *fields, const int *widths, 
+                    const int numFields, void *data); 
+ 
+ 
+/* +-----------------------------------------------------+ 
+   | nx_UnpackNRR() - Split an NRR Image into its Fields | 
+   +-----------------------------------------------------+ 
+ 
+   Preconditions: 
+     - data is a register image as returned by nxhal_ReadNRR 
+     - widths and numFields are as for nx_PackNRR 
+     - fields points to room for numFields values 
+ 
+   Postconditions: 
+     - fields holds each field zero extended; nx_PackNRR of them gives 
+         back data 
+ 
+   Notes: 
+     As for nx_PackNRR, nx_UnpackNRRRef is the reference. 
+*/ 
+ 
+void nx_UnpackNRR (const void *data, const int *widths, 
+                   const int numFields, nxvt_Word *fields); 
+ 
+void nx_UnpackNRRRef (const void *data, const int *widths, 
+                      const int numFields, nxvt_Word *fields); 
+ 
+#endif /* _nxcodec_h_ */
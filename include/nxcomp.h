@@ -0,0 +1,231 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcomp.h 
+ 
+  Synopsis: 
+    Definitions of transport compression between the HAL and the TAL, for 
+    trace events and block memory reads, and of the optional HAL entry 
+    points that carry it 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxcomp_h_ 
+#define _nxcomp_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+ 
+/* +-------------------+ 
+   | compression types | 
+   +-------------------+ */ 
+ 
+/* codec bits, as reported by nxhal_GetCompression and allowed with 
+    NX_CTRL_COMPRESSION; the event and memory streams each have their own 
+    codec, and of the codecs both allow the TAL prefers 
+    NX_COMPRESS_TRACE_DELTA for events and NX_COMPRESS_LZ4 for memory 
+*/ 
+#define NX_COMPRESS_NONE        (0x0) 
+#define NX_COMPRESS_LZ4         (0x1)  /* LZ4 block format */ 
+#define NX_COMPRESS_TRACE_DELTA (0x2)  /* trace delta coder, events only */ 
+ 
+ 
+/* nxt_FrameHeader: starts every frame passed from the HAL to the TAL 
+    - the packed bytes follow the header 
+    - codec is the one selected for the frame's stream, but a HAL may send 
+        any frame with NX_COMPRESS_NONE, e.g. when compressing it would 
+        not make it smaller 
+*/ 
+typedef struct { 
+  int codec;                   /* one NX_COMPRESS_ bit, or none */ 
+  unsigned long rawBytes;      /* bytes after decoding */ 
+  unsigned long packedBytes;   /* bytes following this header */ 
+  int numEvents;               /* events in the frame, 0 for memory */ 
+} nxt_FrameHeader; 
+ 
+ 
+/* Raw bytes of an event frame, i.e. what NX_COMPRESS_NONE sends and LZ4 
+   compresses: numEvents records back to back, with no pointers and no 
+   padding, each 
+    - one byte, the event's nxt_ReadEvent 
+    - NX_READ_EVENT_MESSAGE: numPackets, then for each packet its 
+        numBitsInPacket and its (numBitsInPacket+7)/8 data bytes 
+    - NX_READ_EVENT_BREAKSTEP: the sizeof(nxvt_Registers) bytes of the 
+        registers, as laid out in memory by the HAL, which is built with 
+        the TAL's nxvtypes.h 
+    - NX_READ_EVENT_INPUTPIN: level, as a signed number 
+   Numbers are 7 bit variable length: 7 bits a byte, least significant 
+   first, with bit 7 set in every byte but the last.  A signed number v 
+   is first mapped to (v << 1) ^ (v >> 63), so small negative numbers 
+   stay short.  The TAL rebuilds each nxt_ReceivedEvent in its own queue, 
+   pointing into its own copy of the packet data. 
+*/ 
+ 
+ 
+/* nxt_LinkStats: what the TAL has moved over the link of a handle 
+*/ 
+typedef struct { 
+  unsigned long long rawBytes;     /* bytes after decoding */ 
+  unsigned long long wireBytes;    /* bytes received, headers included */ 
+  unsigned long long decodeMicros; /* time spent decoding */ 
+  unsigned long numFrames; 
+  unsigned long numFramesStored;   /* frames sent as NX_COMPRESS_NONE */ 
+} nxt_LinkStats; 
+ 
+ 
+/* +-------------------------------------------------------+ 
+   | nxhal_GetCompression() - Ask the HAL for its Codecs   | 
+   +-------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle from a successful invocation of nxhal_Open() 
+     - codecs points to where the codec bits will be stored 
+ 
+   Postconditions: 
+     if the HAL can compress, *codecs is set to the codecs it offers and 
+       NX_ERROR_NONE is returned 
+     otherwise NX_ERROR_NO_CAPABILITY is returned and the TAL uses 
+       nxhal_GetEvent and nxhal_ReadNRR as usual 
+ 
+   Notes: 
+     This and the following entry points are optional; a TAL finds out 
+     whether a HAL has them when it is loaded.  Nothing is compressed until 
+     the TAL selects a codec, so a TAL that does not know this file 
+     works unchanged. 
+*/ 
+ 
+nxt_Status nxhal_GetCompression (nxt_Handle *handle, int *codecs); 
+ 
+ 
+/* +-------------------------------------------------------+ 
+   | nxhal_SetCompression() - Select the Codecs to be Used | 
+   +-------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle from a successful invocation of nxhal_Open() 
+     - eventCodec is NX_COMPRESS_NONE or one bit offered by 
+         nxhal_GetCompression, for nxhal_GetEventFrame 
+     - memCodec is NX_COMPRESS_NONE or NX_COMPRESS_LZ4, if offered, for 
+         nxhal_ReadBlock 
+ 
+   Postconditions: 
+     if both codecs are accepted, the function will return NX_ERROR_NONE, 
+       the frames that follow on each stream use its codec, and the 
+       NX_COMPRESS_TRACE_DELTA history is cleared; otherwise it will return 
+       NX_ERROR_NO_CAPABILITY and nothing is changed, e.g. when memCodec is 
+       NX_COMPRESS_TRACE_DELTA, which codes events only 
+*/ 
+ 
+nxt_Status nxhal_SetCompression (nxt_Handle *handle, const int eventCodec, 
+                                 const int memCodec); 
+ 
+ 
+/* +-------------------------------------------------------+ 
+   | nxhal_GetEventFrame() - Read a Frame of Events        | 
+   +-------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle from a successful invocation of nxhal_Open() 
+     - frame points to maxBytes bytes for a header and its packed bytes 
+     - if block != 0, will block until something is read, else will poll 
+ 
+   Postconditions: 
+     if a frame is read, it is stored where frame points and NX_ERROR_NONE 
+       is returned 
+     otherwise returns NX_ERROR_FAILED, or NX_ERROR_NO_SPACE if the next 
+       frame is larger than maxBytes 
+ 
+   Notes: 
+     The TAL decodes frames into a queue of events and serves nx_GetEvent 
+     from it.  NX_COMPRESS_TRACE_DELTA sends the raw bytes (see 
+     nxt_FrameHeader), except that each message packet but packet 0 is 
+     coded as a number h and then: 
+       - h == 0: nothing; the packet equals the same packet of the last 
+           message with the same TCODE (e.g. SRC) 
+       - h == 2 * numBitsInPacket: its data bytes, as in the raw bytes 
+       - h == 2 * numBitsInPacket + 1: a signed number, the difference 
+           from the same packet of the last message with the same TCODE, 
+           both read as unsigned numbers of up to 64 bits, taken modulo 
+           2^64; the TAL adds it, modulo 2^64, and keeps numBitsInPacket 
+           bits 
+     Packet 0 holds the TCODE, which selects the history, so it is always 
+     sent as in the raw bytes.  The decoder needs no packet layout: the 
+     HAL knows which packet is TSTAMP, or any other counter, and marks it 
+     with an odd h.  The history is of decoded messages, so it also 
+     follows frames sent as NX_COMPRESS_NONE or LZ4, and it is cleared by 
+     nxhal_SetCompression.  This removes most of the redundancy of a 
+     BTM/DTM stream at a fraction of the cost of a general purpose coder. 
+*/ 
+ 
+nxt_Status nxhal_GetEventFrame (nxt_Handle *handle, void *frame, 
+                                int maxBytes, const int block); 
+ 
+ 
+/* +-------------------------------------------------------+ 
+   | nxhal_ReadBlock() - Read Target Memory in Frames      | 
+   +-------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle from a successful invocation of nxhal_Open() 
+     - map, accessPriority, addr, numBytes and accessSize are as for 
+         nx_ReadMem 
+     - frame points to maxBytes bytes for a header and its packed bytes 
+     - numRead points to where the number of raw bytes covered by the 
+         frame will be stored 
+ 
+   Postconditions: 
+     if the read succeeds, the probe has read up to numBytes from addr 
+       on its own, the frame holds them and NX_ERROR_NONE is returned; the 
+       TAL calls again from addr + *numRead for the rest 
+     otherwise returns NX_ERROR_FAILED 
+ 
+   Notes: 
+     nx_ReadMem uses this in place of a sequence of NRR accesses when 
+     memCodec is NX_COMPRESS_LZ4, which is what makes large dumps of 
+     mostly blank or repetitive memory cheap over a slow link.  The raw 
+     bytes of a memory frame are the memory read, in ascending address 
+     order. 
+*/ 
+ 
+nxt_Status nxhal_ReadBlock (nxt_Handle *handle, 
+                            const int map, const int accessPriority, 
+                            const nxvt_Address addr, const size_t numBytes, 
+                            const int accessSize, 
+                            void *frame, int maxBytes, size_t *numRead); 
+ 
+ 
+/* +-------------------------------------------------------+ 
+   | nx_GetLinkStats() - Read the Link Statistics          | 
+   +-------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - stats points to where the statistics will be stored 
+ 
+   Postconditions: 
+     - stats holds the totals since nx_Open, and NX_ERROR_NONE is returned 
+ 
+   Notes: 
+     rawBytes / wireBytes is the compression ratio achieved.  Together 
+     with decodeMicros it shows whether a codec pays off at the link 
+     speed set on a simulated HAL with NX_CTRL_LINK_MODEL: it does when 
+     rawBytes > wireBytes and 
+       1000000 * (rawBytes - wireBytes) / bytesPerSecond > decodeMicros 
+     The fields are unsigned, so test rawBytes > wireBytes first; when it 
+     fails the codec has made the stream larger and does not pay off. 
+*/ 
+ 
+nxt_Status nx_GetLinkStats (nxt_Handle *handle, nxt_LinkStats *stats); 
+ 
+#endif /* _nxcomp_h_ */
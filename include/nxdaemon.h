@@ -0,0 +1,381 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxdaemon.h 
+ 
+  Synopsis: 
+    Definitions of the NEXUS target daemon: a local process which owns the 
+    target connections (nxt_Handle) and shares them between several client 
+    processes through shared memory 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxdaemon_h_ 
+#define _nxdaemon_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+/* fixed width types for the shared memory layout 
+*/ 
+#include <stdint.h> 
+ 
+ 
+/* version string for v1.0 of the daemon protocol 
+*/ 
+#define NXD_VERSION_STRING_10 "nxDaemonv1.0" 
+ 
+ 
+/* +---------------------+ 
+   | shared memory types | 
+   +---------------------+ */ 
+ 
+/* The shared memory layout is the same for 32 and 64 bit processes: it 
+   only uses fixed width types, and every 64 bit field is 8 byte aligned. 
+ 
+   Memory ordering: the counters marked "atomic" are only accessed with 
+   atomic loads and stores (C11 <stdatomic.h> or the compiler's 
+   equivalent), never through plain or volatile accesses. 
+     - a producer fills a slot first and publishes it last, with a 
+         release store of head, done or sequence 
+     - a consumer reads the published counter with an acquire load before 
+         it touches the slot 
+*/ 
+ 
+/* NXD_RING_MAGIC: first word of every shared ring, used by clients to 
+    check that a mapping really is a daemon ring of the same layout 
+*/ 
+#define NXD_RING_MAGIC (0x4e584452)   /* "NXDR" */ 
+ 
+/* NXD_LAYOUT_VERSION: layout of the structures in this section 
+*/ 
+#define NXD_LAYOUT_VERSION (3) 
+ 
+ 
+/* nxt_RingHeader: header at offset 0 of every shared ring 
+    - head is only written by the producer, tail only by the consumer; 
+        in the trace ring, whose readers keep private tails, tail is 
+        unused and stays 0 
+    - both are free running counters; slot = counter % numSlots 
+    - numSlots is a power of two 
+*/ 
+typedef struct { 
+  uint32_t magic;               /* NXD_RING_MAGIC */ 
+  uint32_t layoutVersion;       /* NXD_LAYOUT_VERSION */ 
+  uint32_t numSlots; 
+  uint32_t slotSize;            /* bytes per slot, including its header */ 
+  uint64_t head;                /* atomic: next slot to be produced */ 
+  uint64_t tail;                /* atomic: next slot to be consumed */ 
+} nxt_RingHeader; 
+ 
+ 
+/* nxt_MemRequestTag: memory operations carried by the request ring 
+*/ 
+typedef enum { 
+  NXD_MEMREQ_READ  = 0x1, 
+  NXD_MEMREQ_WRITE = 0x2 
+} nxt_MemRequestTag; 
+ 
+ 
+/* nxt_MemRequest: one slot of a client's memory request ring 
+    - the arguments are those of nx_ReadMem/nx_WriteMem 
+    - the data follows the request in the same slot, so a request is never 
+        larger than slotSize - sizeof(nxt_MemRequest) bytes; larger 
+        transfers are split by the client library 
+    - the client fills the request and its data, then publishes head; 
+        the daemon sets status (and the data read), then publishes done; 
+        sequence lets the client match completions to requests 
+*/ 
+typedef struct { 
+  uint64_t sequence; 
+  int64_t addr;             /* nxvt_Address */ 
+  uint64_t numBytes; 
+  uint32_t mTag;            /* nxt_MemRequestTag */ 
+  int32_t map; 
+  int32_t accessPriority; 
+  int32_t accessSize; 
+  uint32_t status;          /* nxt_Status, valid once done != 0 */ 
+  uint32_t done;            /* atomic */ 
+} nxt_MemRequest; 
+ 
+ 
+/* nxt_ShmPacket: an nxt_Packet as held in the trace ring 
+    - dataOffset is in bytes from the start of the nxt_ShmEvent; the data 
+        has no alignment 
+*/ 
+typedef struct { 
+  uint32_t numBitsInPacket; 
+  uint32_t dataOffset; 
+} nxt_ShmPacket; 
+ 
+ 
+/* nxt_ShmEvent: an nxt_ReceivedEvent as held in the trace ring 
+    - the ring is mapped at a different address in every process, so it 
+        holds offsets, in bytes from the start of this structure, in 
+        place of the pointers of nxt_Message and nxt_Packet 
+    - use NXD_SHM_PTR to turn an offset into a pointer 
+    - the event is 8 byte aligned, packetsOffset is a multiple of 4 and 
+        regsOffset a multiple of 8, so the pointers NXD_SHM_PTR makes 
+        are aligned for nxt_ShmPacket and nxvt_Registers 
+*/ 
+typedef struct { 
+  uint32_t rTag;            /* nxt_ReadEvent */ 
+  uint32_t numPackets;      /* if rTag == NX_READ_EVENT_MESSAGE */ 
+  uint32_t packetsOffset;   /*   offset of numPackets nxt_ShmPacket */ 
+  uint32_t regsOffset;      /* if rTag == NX_READ_EVENT_BREAKSTEP, offset */ 
+                            /*   of an nxvt_Registers */ 
+  int32_t inputPinLevel;    /* if rTag == NX_READ_EVENT_INPUTPIN */ 
+  uint32_t reserved; 
+} nxt_ShmEvent; 
+ 
+/* NXD_SHM_PTR: pointer to the item at offset in the event ev 
+*/ 
+#define NXD_SHM_PTR(ev, offset) ((const unsigned char *)(ev) + (offset)) 
+ 
+ 
+/* NXD_SEQ_BUSY, NXD_SEQ_READY: values of nxt_TraceSlot.sequence while 
+    slot n is written, and once it is published 
+*/ 
+#define NXD_SEQ_BUSY(n)  (2 * (uint64_t)(n) + 1) 
+#define NXD_SEQ_READY(n) (2 * (uint64_t)(n)) 
+ 
+ 
+/* nxt_TraceSlot: one slot of the shared trace ring 
+    - the daemon is the only producer; any number of readers follow it, 
+        each with its own private tail, so readers never copy or lock 
+    - to produce slot n the daemon stores NXD_SEQ_BUSY(n) in sequence, 
+        issues a release fence, so that none of its writes to the slot 
+        become visible before that store, fills the slot, stores 
+        NXD_SEQ_READY(n) with release, and then advances head with release 
+    - a reader expecting slot n loads sequence with acquire: 
+        NXD_SEQ_READY(n) means the slot is ready, NXD_SEQ_BUSY(n) or a 
+        value below it that it is not produced yet, and a value above 
+        NXD_SEQ_BUSY(n) that the reader has been overrun 
+    - the packets, their data and the registers live in the data area, 
+        which immediately follows this structure; slotSize is a multiple 
+        of 8 
+*/ 
+typedef struct { 
+  uint64_t sequence;           /* atomic */ 
+  uint32_t numBytes;           /* bytes used in the data area */ 
+  uint32_t reserved; 
+  nxt_ShmEvent event; 
+} nxt_TraceSlot; 
+ 
+ 
+/* +-------------------------+ 
+   | daemon management types | 
+   +-------------------------+ */ 
+ 
+/* nxt_DaemonSpec: defines how a daemon is started 
+*/ 
+typedef struct { 
+  const char *name;        /* names the daemon's shared memory objects */ 
+  int maxClients;          /* max number of attached client processes */ 
+  int memRingSlots;        /* slots per client request ring, power of 2 */ 
+  int memSlotSize;         /* bytes per request slot */ 
+  int traceRingSlots;      /* slots in the shared trace ring, power of 2 */ 
+  int traceSlotSize;       /* bytes per trace slot */ 
+} nxt_DaemonSpec; 
+ 
+ 
+/* nxt_Daemon: an opaque reference to a running daemon 
+*/ 
+typedef struct nxt_DaemonTag nxt_Daemon; 
+ 
+ 
+/* nxt_TraceReader: an opaque reference to a client's view of a trace ring 
+*/ 
+typedef struct nxt_TraceReaderTag nxt_TraceReader; 
+ 
+ 
+/* +------------------------------------------+ 
+   | nxd_Start() - Start a Daemon in-process  | 
+   +------------------------------------------+ 
+ 
+   Preconditions: 
+     - dSpec specifies the name and ring sizes of the daemon 
+     - errorCallback is a callback function which may be invoked 
+         when errors occur 
+ 
+   Postconditions: 
+     if succeeds, the shared memory objects are created, a daemon reference 
+       is returned and status is set to NX_ERROR_NONE 
+     if another daemon already owns dSpec->name, NULL is returned and 
+       status is set to NX_ERROR_FAILED 
+ 
+   Notes: 
+     The daemon drives the targets through the nxhal_* entry points only, 
+     so any HAL, including a simulated one, can be linked beneath it. 
+*/ 
+ 
+nxt_Daemon *nxd_Start (const nxt_DaemonSpec *dSpec, 
+                       void (*errorCallback)(const char *), 
+                       nxt_Status *status); 
+ 
+ 
+/* +-----------------------------+ 
+   | nxd_Stop() - Stop a Daemon  | 
+   +-----------------------------+ 
+ 
+   Preconditions: 
+     - daemon is from a successful invocation of nxd_Start 
+ 
+   Postconditions: 
+     - every attached client is detached, its pending requests complete 
+         with NX_ERROR_FAILED 
+     - every target owned by the daemon is closed with nxhal_Close 
+     - the shared memory objects are removed and the daemon deallocated 
+*/ 
+ 
+void nxd_Stop (nxt_Daemon *daemon); 
+ 
+ 
+/* +-------------------------------------------------+ 
+   | nxd_Attach() - Open a Target through a Daemon   | 
+   +-------------------------------------------------+ 
+ 
+   Preconditions: 
+     - name is the name a daemon was started with 
+     - tSpec specifies the target setup, as for nx_Open 
+     - errorCallback is a callback function which may be invoked 
+         when errors occur 
+ 
+   Postconditions: 
+     if succeeds, a handle is returned and status is set to NX_ERROR_NONE 
+       - if the daemon already owns a target matching tSpec the handle 
+           shares that connection and no target setup is performed; 
+           otherwise the daemon opens it with nxhal_Open 
+       - the handle's cap is a copy of the daemon's capabilities 
+       - the handle may be passed to every nx_* entry point, with the 
+           semantics given in nxapi.h; nx_ReadMem and nx_WriteMem are 
+           carried by the client's request ring, all other calls by the 
+           daemon's control channel 
+     if fails, NULL is returned, and status is set to NX_ERROR_FAILED 
+       (no daemon) or NX_ERROR_NO_CAPABILITY (target cannot be opened) 
+ 
+   Notes: 
+     Event IDs are owned by the target, not by the client: an eid set by one 
+     client may be cleared by another.  Clients that need exclusive use 
+     of a target should select themselves with NX_CTRL_SET_CLIENT. 
+*/ 
+ 
+nxt_Handle *nxd_Attach (const char *name, 
+                        const nxt_TargetSpec *tSpec, 
+                        void (*errorCallback)(const char *), 
+                        nxt_Status *status); 
+ 
+ 
+/* +--------------------------------------------+ 
+   | nxd_Detach() - Release a Daemon's Target   | 
+   +--------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nxd_Attach 
+ 
+   Postconditions: 
+     - the handle is deallocated; the daemon keeps the target open for 
+         other and later clients 
+     - returned status indicates whether the detach was successful 
+ 
+   Notes: 
+     nx_Close on a handle from nxd_Attach is equivalent to nxd_Detach. 
+*/ 
+ 
+nxt_Status nxd_Detach (nxt_Handle *handle); 
+ 
+ 
+/* +---------------------------------------------------+ 
+   | nxd_OpenTraceReader() - Follow a Target's Events  | 
+   +---------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nxd_Attach 
+ 
+   Postconditions: 
+     if succeeds, the trace ring of the target is mapped read-only, 
+       a reader positioned at the current head is returned and status 
+       is set to NX_ERROR_NONE 
+     otherwise NULL is returned and status is set to NX_ERROR_FAILED 
+ 
+   Notes: 
+     The daemon alone drains nxhal_GetEvent for a target once a reader 
+     exists; nx_GetEvent on the same handle then reads through a private 
+     reader of its own. 
+*/ 
+ 
+nxt_TraceReader *nxd_OpenTraceReader (nxt_Handle *handle, 
+                                      nxt_Status *status); 
+ 
+ 
+/* +-----------------------------------------------------+ 
+   | nxd_ReadTrace() - Read an Event without Copying It  | 
+   +-----------------------------------------------------+ 
+ 
+   Preconditions: 
+     - reader is from a successful invocation of nxd_OpenTraceReader 
+     - event points to where a pointer to the event will be stored 
+     - if block != 0, will block until an event is available, else will poll 
+ 
+   Postconditions: 
+     if an event is available, *event points into the shared ring and 
+       NX_ERROR_NONE is returned; the event stays in place until 
+       nxd_ReleaseTrace is called, unless the ring overruns the reader 
+       while it is being read, which nxd_ReleaseTrace reports 
+     if the reader has been overrun, it is moved to the oldest slot still 
+       in the ring, *lost is set to the number of events skipped and 
+       NX_ERROR_NO_SPACE is returned 
+     if no event is available and block == 0, NX_ERROR_FAILED is returned 
+*/ 
+ 
+nxt_Status nxd_ReadTrace (nxt_TraceReader *reader, 
+                          const nxt_ShmEvent* *event, 
+                          unsigned long *lost, 
+                          const int block); 
+ 
+ 
+/* +-------------------------------------------------+ 
+   | nxd_ReleaseTrace() - Release the Current Event  | 
+   +-------------------------------------------------+ 
+ 
+   Preconditions: 
+     - reader is from a successful invocation of nxd_OpenTraceReader 
+     - an event was returned by the last call of nxd_ReadTrace 
+ 
+   Postconditions: 
+     - the reader's tail is advanced past the event; the returned event 
+         pointer must no longer be used 
+     - the slot's sequence is loaded again (after an acquire fence) and 
+         compared with the value nxd_ReadTrace found: if they differ, the 
+         daemon overwrote the slot while it was being read, anything taken 
+         from it must be discarded, and NX_ERROR_NO_SPACE is returned; 
+         otherwise NX_ERROR_NONE is returned 
+*/ 
+ 
+nxt_Status nxd_ReleaseTrace (nxt_TraceReader *reader); 
+ 
+ 
+/* +------------------------------------------------+ 
+   | nxd_CloseTraceReader() - Stop Following Events | 
+   +------------------------------------------------+ 
+ 
+   Preconditions: 
+     - reader is from a successful invocation of nxd_OpenTraceReader 
+ 
+   Postconditions: 
+     - the ring is unmapped and the reader deallocated 
+*/ 
+ 
+void nxd_CloseTraceReader (nxt_TraceReader *reader); 
+ 
+#endif /* _nxdaemon_h_ */
@@ -0,0 +1,281 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxevent.h 
+ 
+  Synopsis: 
+    Definitions of the virtual event layer, which maps any number of 
+    logical breakpoints and watchpoints onto the target's comparators 
+    and, for instruction breakpoints, onto software breakpoints 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxevent_h_ 
+#define _nxevent_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+ 
+/* +---------------------+ 
+   | virtual event types | 
+   +---------------------+ */ 
+ 
+/* NXE_ID_INVALID: logical event ID that is not available 
+*/ 
+#define NXE_ID_INVALID (0) 
+ 
+/* NXE_ID_UNKNOWN: a hit which cannot be told apart between several 
+    logical events, see nxe_GetEvent 
+*/ 
+#define NXE_ID_UNKNOWN (-1) 
+ 
+ 
+/* nxt_EventPolicy: where a logical event may be placed 
+*/ 
+typedef enum { 
+  NXE_POLICY_ANY,        /* hardware if a comparator can be had, else software */ 
+  NXE_POLICY_HARDWARE,   /* a comparator (exact or merged) or nothing */ 
+  NXE_POLICY_SOFTWARE    /* software breakpoint only */ 
+} nxt_EventPolicy; 
+ 
+ 
+/* nxt_EventPlacement: where a logical event has been placed 
+*/ 
+typedef enum { 
+  NXE_PLACE_NONE,        /* not placed, see nxe_Commit */ 
+  NXE_PLACE_EXACT,       /* owns a comparator */ 
+  NXE_PLACE_MERGED,      /* shares an instruction comparator via addr/mask */ 
+  NXE_PLACE_SOFTWARE     /* code patched with NXVT_SWBREAK_OPCODE_* */ 
+} nxt_EventPlacement; 
+ 
+ 
+/* nxt_EventCommitStats: what nxe_Commit did to the target 
+*/ 
+typedef struct { 
+  int numExact;            /* logical events on their own comparator */ 
+  int numMerged;           /* logical events sharing a comparator */ 
+  int numSoftware;         /* logical events patched into code */ 
+  int numUnplaced;         /* logical events that could not be placed */ 
+  int numSetEvents;        /* nx_SetEvent calls issued */ 
+  int numClearEvents;      /* nx_ClearEvent calls issued */ 
+  int numWriteMems;        /* nx_WriteMem calls issued for patches */ 
+} nxt_EventCommitStats; 
+ 
+ 
+/* NXE_FLAG_NO_MERGE: nxe_Begin flag for targets whose comparators do not 
+    mask instruction addresses 
+*/ 
+#define NXE_FLAG_NO_MERGE (0x1) 
+ 
+ 
+/* nxt_EventBatch: an opaque reference to a set of pending changes 
+*/ 
+typedef struct nxt_EventBatchTag nxt_EventBatch; 
+ 
+ 
+/* +----------------------------------------------+ 
+   | nxe_Begin() - Start a Batch of Event Changes | 
+   +----------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - flags is 0 or NXE_FLAG_NO_MERGE 
+ 
+   Postconditions: 
+     if succeeds, returns an empty batch, otherwise NULL 
+ 
+   Notes: 
+     Only one batch may be open per handle.  Until the batch is committed 
+     the target is not touched. 
+*/ 
+ 
+nxt_EventBatch *nxe_Begin (nxt_Handle *handle, const int flags); 
+ 
+ 
+/* +-------------------------------------+ 
+   | nxe_Set() - Add a Logical Event     | 
+   +-------------------------------------+ 
+ 
+   Preconditions: 
+     - batch is from a successful invocation of nxe_Begin 
+     - setEvent defines the event as for nx_SetEvent; eType must be 
+         NX_ETYPE_BREAKPOINT or NX_ETYPE_WATCHPOINT and eid is ignored 
+     - policy restricts where the event may be placed 
+     - lid points to where the logical event ID will be stored 
+ 
+   Postconditions: 
+     if succeeds, *lid is set to a new logical event ID, which is never 
+       reused within the life of the handle, and NX_ERROR_NONE is returned 
+     if policy is NXE_POLICY_SOFTWARE and the event is not an 
+       NX_BREAKPOINT_INSTRADDR breakpoint, or cap.targetEndian is neither 
+       NX_ENDIAN_BIG nor NX_ENDIAN_LITTLE, returns NX_ERROR_NO_CAPABILITY 
+*/ 
+ 
+nxt_Status nxe_Set (nxt_EventBatch *batch, 
+                    const nxt_SetEvent *setEvent, 
+                    const nxt_EventPolicy policy, 
+                    int *lid); 
+ 
+ 
+/* +--------------------------------------+ 
+   | nxe_Clear() - Remove a Logical Event | 
+   +--------------------------------------+ 
+ 
+   Preconditions: 
+     - batch is from a successful invocation of nxe_Begin 
+     - lid is from nxe_Set on the same handle 
+ 
+   Postconditions: 
+     - the event will be removed when the batch is committed 
+*/ 
+ 
+void nxe_Clear (nxt_EventBatch *batch, const int lid); 
+ 
+ 
+/* +-------------------------------------------------+ 
+   | nxe_Commit() - Apply a Batch in one Transaction | 
+   +-------------------------------------------------+ 
+ 
+   Preconditions: 
+     - batch is from a successful invocation of nxe_Begin 
+     - the target is halted if the batch adds or removes software 
+         breakpoints 
+     - stats points to where the figures will be stored, or is NULL 
+ 
+   Postconditions: 
+     if succeeds, the target's comparators and code match the set of 
+       logical events after the batch, the batch is deallocated and 
+       NX_ERROR_NONE is returned 
+     if fails, the target is left as before nxe_Begin, the batch is 
+       deallocated and NX_ERROR_FAILED is returned 
+ 
+   Notes: 
+     The placement is recomputed for the whole set: 
+       1. events with NXE_POLICY_SOFTWARE are patched 
+       2. watchpoints, and breakpoints on data addresses or values, each 
+            get a comparator of their own, as set, while comparators last; 
+            they are never merged, since a merged data hit could not be 
+            told apart (see nxe_GetEvent) 
+       3. NX_BREAKPOINT_INSTRADDR breakpoints are grouped by eoMode and 
+            sorted by address; while more comparators are needed than 
+            breakMinEventId..breakMaxEventId has left, the two neighbours 
+            whose merge covers the fewest extra addresses share one 
+            comparator, set with addr as the base of the smallest aligned 
+            range covering both and mask as its address mask (a bit set 
+            to 1 is compared, a bit set to 0 is ignored); data is unused 
+            for this operand 
+       4. instruction breakpoints left over with NXE_POLICY_ANY are 
+            patched; any others are left NXE_PLACE_NONE 
+     Step 3 relies on the target applying mask to the instruction address; 
+     nxe_Begin with NXE_FLAG_NO_MERGE skips it on targets that do not. 
+     Only comparators whose contents change are cleared and set, in one 
+     pass.  Patches to adjacent addresses are written by a single 
+     nx_WriteMem, and the original code is kept so it can be put back. 
+     The patch is NXVT_SWBREAK_OPCODE_BIG or NXVT_SWBREAK_OPCODE_LITTLE 
+     as cap.targetEndian says; on a target of any other byte order 
+     nothing is patched, so step 4 leaves NXE_PLACE_NONE. 
+*/ 
+ 
+nxt_Status nxe_Commit (nxt_EventBatch *batch, nxt_EventCommitStats *stats); 
+ 
+ 
+/* +------------------------------------------+ 
+   | nxe_Abort() - Discard a Batch            | 
+   +------------------------------------------+ 
+ 
+   Preconditions: 
+     - batch is from a successful invocation of nxe_Begin 
+ 
+   Postconditions: 
+     - the batch is deallocated, the target is not touched 
+*/ 
+ 
+void nxe_Abort (nxt_EventBatch *batch); 
+ 
+ 
+/* +------------------------------------------------+ 
+   | nxe_Query() - Find out where an Event was Put  | 
+   +------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - lid is from nxe_Set on the same handle 
+ 
+   Postconditions: 
+     - returns the placement made by the last nxe_Commit 
+*/ 
+ 
+nxt_EventPlacement nxe_Query (nxt_Handle *handle, const int lid); 
+ 
+ 
+/* +---------------------------------------------------+ 
+   | nxe_GetEvent() - Read an Event as Logical Events  | 
+   +---------------------------------------------------+ 
+ 
+   Preconditions: 
+     - as for nx_GetEvent 
+     - lid points to where the ID of the logical event hit will be stored 
+ 
+   Postconditions: 
+     as for nx_GetEvent, and *lid is set: 
+       - for NX_READ_EVENT_BREAKSTEP, to the instruction breakpoint whose 
+           address is regs.pc; if there is none, to the one data 
+           breakpoint placed, or NXE_ID_UNKNOWN if several are placed, 
+           since the registers do not say which data address was hit 
+       - for a watchpoint hit message, to the watchpoint of the 
+           comparator named by its WPHIT packet; each such comparator 
+           holds exactly one logical watchpoint 
+       - for other events, to NXE_ID_INVALID 
+ 
+   Notes: 
+     A hit on a merged comparator whose regs.pc matches none of its 
+     logical events is not returned: the target is restarted with 
+     NX_CTRL_RESTART_FROM_BREAKSTEP and the next event is read.  A hit on 
+     a software breakpoint is reported with the original code put back 
+     while the target is halted; restart it with nxe_Restart. 
+*/ 
+ 
+nxt_Status nxe_GetEvent (nxt_Handle *handle, nxt_ReceivedEvent *event, 
+                         int maxBytes, const int block, int *lid); 
+ 
+ 
+/* +---------------------------------------------------+ 
+   | nxe_Restart() - Restart after a Breakpoint        | 
+   +---------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - the target is halted on an event read with nxe_GetEvent 
+     - regs is the register set to restart with, as for 
+         NX_CTRL_RESTART_FROM_BREAKSTEP 
+ 
+   Postconditions: 
+     if succeeds, the target is running with every software breakpoint 
+       in place and NX_ERROR_NONE is returned 
+     otherwise returns NX_ERROR_FAILED; the target is halted and the 
+       software breakpoint at regs.pc, if any, is not in place 
+ 
+   Notes: 
+     If regs.pc holds a software breakpoint, its original code is still 
+     in place: the layer sets an NX_ETYPE_STEP event, restarts, waits for 
+     the step to complete, clears the step event, writes 
+     the patch back with nx_WriteMem and restarts again. 
+     Otherwise this is nx_Control with NX_CTRL_RESTART_FROM_BREAKSTEP. 
+     Restarting after a software breakpoint by any other means leaves 
+     that breakpoint disarmed. 
+*/ 
+ 
+nxt_Status nxe_Restart (nxt_Handle *handle, const nxvt_Registers *regs); 
+ 
+#endif /* _nxevent_h_ */
@@ -0,0 +1,245 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxpump.h 
+ 
+  Synopsis: 
+    Definitions of the event pump, which runs nx_* operations for many 
+    targets from one thread and reports each one through a completion 
+    callback, so scripts never block a thread waiting for an event 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxpump_h_ 
+#define _nxpump_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+ 
+/* +------------+ 
+   | pump types | 
+   +------------+ */ 
+ 
+/* NX_ERROR_NO_EVENT (nxtypes.h): returned by nx_GetEvent and 
+    nxhal_GetEvent, when called with block == 0 by a TAL and HAL that 
+    support the pump, if no event is available; unlike NX_ERROR_FAILED it 
+    is not an error, and the error callback is not invoked.  Such a TAL 
+    accepts nx_Control with NX_CTRL_NO_EVENT (nxvtypes.h); any other 
+    returns NX_ERROR_FAILED when there is no event. 
+*/ 
+ 
+ 
+/* nxt_Completion: called once when an operation has finished 
+    - ctx is the value given when the operation was submitted 
+    - status is what the nx_* entry point returned, or NX_ERROR_FAILED if 
+        the operation was cancelled 
+ 
+   nxpump.hpp wraps each submission in a C++20 awaitable whose 
+   completion resumes the waiting coroutine. 
+*/ 
+typedef void (*nxt_Completion)(void *ctx, nxt_Status status); 
+ 
+ 
+/* nxt_Pump: an opaque reference to an event pump 
+*/ 
+typedef struct nxt_PumpTag nxt_Pump; 
+ 
+ 
+/* +---------------------------------+ 
+   | nxp_Create() - Create a Pump    | 
+   +---------------------------------+ 
+ 
+   Preconditions: 
+     - maxTargets is the most handles that will be added at once 
+ 
+   Postconditions: 
+     if succeeds, returns an empty pump, otherwise NULL 
+ 
+   Notes: 
+     A pump is used from one thread only, the one calling nxp_Run.  Several 
+     pumps, each on its own thread, share the work of a large number of 
+     targets. 
+*/ 
+ 
+nxt_Pump *nxp_Create (const int maxTargets); 
+ 
+ 
+/* +---------------------------------+ 
+   | nxp_Destroy() - Destroy a Pump  | 
+   +---------------------------------+ 
+ 
+   Preconditions: 
+     - pump is from a successful invocation of nxp_Create 
+ 
+   Postconditions: 
+     - every pending operation is completed with NX_ERROR_FAILED, then the 
+         pump is deallocated; the handles are not closed 
+ 
+   Notes: 
+     An nxp_* call made on the pump by one of these completions returns 
+     NX_ERROR_FAILED at once; nothing is queued and its done is never 
+     called. 
+*/ 
+ 
+void nxp_Destroy (nxt_Pump *pump); 
+ 
+ 
+/* +-----------------------------------------+ 
+   | nxp_Add() - Put a Target on a Pump      | 
+   +-----------------------------------------+ 
+ 
+   Preconditions: 
+     - pump is from a successful invocation of nxp_Create 
+     - handle is from a successful invocation of nx_Open, and on no 
+         other pump 
+ 
+   Postconditions: 
+     - returns NX_ERROR_NONE, or NX_ERROR_NO_SPACE if maxTargets handles 
+         are already on the pump 
+     - the pump has asked the TAL with NX_CTRL_NO_EVENT whether it 
+         returns NX_ERROR_NO_EVENT, which nxp_GetEvent needs 
+*/ 
+ 
+nxt_Status nxp_Add (nxt_Pump *pump, nxt_Handle *handle); 
+ 
+ 
+/* +-----------------------------------------+ 
+   | nxp_Remove() - Take a Target off a Pump | 
+   +-----------------------------------------+ 
+ 
+   Preconditions: 
+     - handle was added to pump with nxp_Add 
+ 
+   Postconditions: 
+     - the handle's pending operations are completed with NX_ERROR_FAILED 
+         and the handle is no longer on the pump 
+ 
+   Notes: 
+     A submission for handle made by one of these completions returns 
+     NX_ERROR_FAILED at once; nothing is queued and its done is never 
+     called.  Submissions for other handles are queued as usual. 
+*/ 
+ 
+void nxp_Remove (nxt_Pump *pump, nxt_Handle *handle); 
+ 
+ 
+/* +--------------------------------------------------+ 
+   | nxp_Control() etc. - Submit an Operation         | 
+   +--------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle was added to pump with nxp_Add 
+     - the other arguments are those of the nx_* entry point of the same 
+         name; buffers must stay valid until the operation completes 
+     - done is called with ctx when the operation has finished 
+ 
+   Postconditions: 
+     - the operation is queued behind the handle's earlier operations and 
+         NX_ERROR_NONE is returned; nothing is done until nxp_Run 
+     - if the pump is being destroyed, or handle removed, NX_ERROR_FAILED 
+         is returned at once and done is never called (see nxp_Destroy) 
+ 
+   Notes: 
+     Operations on one handle run in the order submitted; operations on 
+     different handles interleave.  nxp_ReadMem copies the data read to 
+     buffer before done is called. 
+     These operations call their nx_* entry point synchronously on the 
+     pump's thread, and no other target on the pump makes progress 
+     meanwhile: one large nxp_ReadMem stalls them all.  How many scripts 
+     a pump can carry is bounded by the time its operations take, so 
+     split large transfers, or give targets doing bulk transfers a pump 
+     of their own. 
+*/ 
+ 
+nxt_Status nxp_Control (nxt_Pump *pump, nxt_Handle *handle, 
+                        const nxt_CtrlData *ctrl, 
+                        nxt_Completion done, void *ctx); 
+ 
+nxt_Status nxp_SetEvent (nxt_Pump *pump, nxt_Handle *handle, 
+                         const nxt_SetEvent *setEvent, 
+                         nxt_Completion done, void *ctx); 
+ 
+nxt_Status nxp_ClearEvent (nxt_Pump *pump, nxt_Handle *handle, 
+                           const int eid, 
+                           nxt_Completion done, void *ctx); 
+ 
+nxt_Status nxp_ReadMem (nxt_Pump *pump, nxt_Handle *handle, 
+                        const int map, const int accessPriority, 
+                        const nxvt_Address addr, const size_t numBytes, 
+                        const int accessSize, void *buffer, 
+                        nxt_Completion done, void *ctx); 
+ 
+nxt_Status nxp_WriteMem (nxt_Pump *pump, nxt_Handle *handle, 
+                         const int map, const int accessPriority, 
+                         const nxvt_Address addr, const size_t numBytes, 
+                         const int accessSize, const void *bytesToWrite, 
+                         nxt_Completion done, void *ctx); 
+ 
+ 
+/* +------------------------------------------------+ 
+   | nxp_GetEvent() - Wait for an Event             | 
+   +------------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle was added to pump with nxp_Add 
+     - event and maxBytes are as for nx_GetEvent; event must stay valid 
+         until the operation completes 
+     - done is called with ctx once an event has been stored 
+ 
+   Postconditions: 
+     - the wait is queued as for nxp_Control and NX_ERROR_NONE is returned 
+     - if the TAL did not accept NX_CTRL_NO_EVENT when handle was added, 
+         NX_ERROR_NO_CAPABILITY is returned and nothing is queued 
+ 
+   Notes: 
+     The pump never calls nx_GetEvent with block != 0.  A handle whose 
+     first queued operation is a wait is polled on each nxp_Run pass; the 
+     operations behind it wait for the event, as they would in a script. 
+     NX_ERROR_NO_EVENT keeps the wait queued; any other failure, e.g. 
+     from a target that has gone away, completes it with that status. 
+     A TAL that cannot tell the two apart (it returns NX_ERROR_FAILED 
+     when there is no event) does not accept NX_CTRL_NO_EVENT, so such 
+     handles get NX_ERROR_NO_CAPABILITY rather than a wait that fails on 
+     its first poll; their other operations are unaffected. 
+*/ 
+ 
+nxt_Status nxp_GetEvent (nxt_Pump *pump, nxt_Handle *handle, 
+                         nxt_ReceivedEvent *event, int maxBytes, 
+                         nxt_Completion done, void *ctx); 
+ 
+ 
+/* +-------------------------------------------------+ 
+   | nxp_Run() - Run Pending Operations              | 
+   +-------------------------------------------------+ 
+ 
+   Preconditions: 
+     - pump is from a successful invocation of nxp_Create 
+     - timeout is the longest time to wait, in microseconds, when there 
+         is nothing to run; 0 to return at once 
+ 
+   Postconditions: 
+     - returns the number of operations completed by this call 
+ 
+   Notes: 
+     Each pass runs the first queued operation of every handle that has 
+     one, round robin, and polls the waits.  Completions are called from 
+     nxp_Run and may submit further operations, which run on the next 
+     pass.  When a pass completes nothing, the pump sleeps for a time that 
+     doubles from 10 microseconds up to timeout, and is reset by any 
+     completion, so idle targets cost little and busy ones are not held up. 
+*/ 
+ 
+int nxp_Run (nxt_Pump *pump, const long timeout); 
+ 
+#endif /* _nxpump_h_ */
@@ -0,0 +1,158 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxpump.hpp 
+ 
+  Synopsis: 
+    C++20 coroutine facade over the event pump (nxpump.h): each nxp_* 
+    submission is an awaitable, and a script is a coroutine of type 
+    nx::Script which runs on the thread calling nxp_Run 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxpump_hpp_ 
+#define _nxpump_hpp_ 
+ 
+#include <coroutine> 
+#include <exception> 
+ 
+/* Include the event pump 
+*/ 
+extern "C" { 
+#include "nxpump.h" 
+} 
+ 
+namespace nx { 
+ 
+ 
+/* +------------------+ 
+   | awaitable types  | 
+   +------------------+ */ 
+ 
+/* Op: awaits one pump operation 
+    - submit(done, ctx) queues the operation and returns the status of 
+        the nxp_* call; if that is not NX_ERROR_NONE the coroutine is not 
+        suspended and co_await yields it at once 
+    - otherwise co_await yields the status passed to the completion 
+    - the operation's arguments are held by submit, i.e. in the 
+        coroutine frame, so they stay valid until the operation completes 
+*/ 
+template <class Submit> 
+class Op { 
+public: 
+  explicit Op (Submit submit) : submit_(submit) {} 
+ 
+  bool await_ready () const noexcept { return false; } 
+ 
+  bool await_suspend (std::coroutine_handle<> waiter) { 
+    waiter_ = waiter; 
+    status_ = submit_(&Op::complete, this); 
+    return status_ == NX_ERROR_NONE; 
+  } 
+ 
+  nxt_Status await_resume () const noexcept { return status_; } 
+ 
+private: 
+  static void complete (void *ctx, nxt_Status status) { 
+    Op *op = static_cast<Op *>(ctx); 
+    op->status_ = status; 
+    op->waiter_.resume(); 
+  } 
+ 
+  Submit submit_; 
+  std::coroutine_handle<> waiter_; 
+  nxt_Status status_ = NX_ERROR_NONE; 
+}; 
+ 
+ 
+/* Script: a fire-and-forget coroutine running a target script 
+    - it starts at once and runs until its first co_await, then carries 
+        on from nxp_Run each time an operation completes 
+    - its frame is freed when it returns 
+*/ 
+struct Script { 
+  struct promise_type { 
+    Script get_return_object () noexcept { return Script(); } 
+    std::suspend_never initial_suspend () noexcept { return {}; } 
+    std::suspend_never final_suspend () noexcept { return {}; } 
+    void return_void () noexcept {} 
+    void unhandled_exception () noexcept { std::terminate(); } 
+  }; 
+}; 
+ 
+ 
+/* +-------------------------------------+ 
+   | awaitable operations                | 
+   +-------------------------------------+ 
+ 
+   Each function takes the arguments of the nxp_* function of the same 
+   name, less done and ctx, and returns an awaitable yielding its status. 
+   Structures passed by reference are copied into the awaitable; buffers 
+   passed by pointer must stay valid until the co_await completes. 
+*/ 
+ 
+inline auto control (nxt_Pump *pump, nxt_Handle *handle, 
+                     const nxt_CtrlData &ctrl) 
+{ 
+  return Op([=](nxt_Completion done, void *ctx) { 
+    return nxp_Control(pump, handle, &ctrl, done, ctx); 
+  }); 
+} 
+ 
+inline auto setEvent (nxt_Pump *pump, nxt_Handle *handle, 
+                      const nxt_SetEvent &setEvent) 
+{ 
+  return Op([=](nxt_Completion done, void *ctx) { 
+    return nxp_SetEvent(pump, handle, &setEvent, done, ctx); 
+  }); 
+} 
+ 
+inline auto clearEvent (nxt_Pump *pump, nxt_Handle *handle, int eid) 
+{ 
+  return Op([=](nxt_Completion done, void *ctx) { 
+    return nxp_ClearEvent(pump, handle, eid, done, ctx); 
+  }); 
+} 
+ 
+inline auto readMem (nxt_Pump *pump, nxt_Handle *handle, 
+                     int map, int accessPriority, 
+                     nxvt_Address addr, size_t numBytes, 
+                     int accessSize, void *buffer) 
+{ 
+  return Op([=](nxt_Completion done, void *ctx) { 
+    return nxp_ReadMem(pump, handle, map, accessPriority, addr, numBytes, 
+                       accessSize, buffer, done, ctx); 
+  }); 
+} 
+ 
+inline auto writeMem (nxt_Pump *pump, nxt_Handle *handle, 
+                      int map, int accessPriority, 
+                      nxvt_Address addr, size_t numBytes, 
+                      int accessSize, const void *bytesToWrite) 
+{ 
+  return Op([=](nxt_Completion done, void *ctx) { 
+    return nxp_WriteMem(pump, handle, map, accessPriority, addr, numBytes, 
+                        accessSize, bytesToWrite, done, ctx); 
+  }); 
+} 
+ 
+inline auto getEvent (nxt_Pump *pump, nxt_Handle *handle, 
+                      nxt_ReceivedEvent *event, int maxBytes) 
+{ 
+  return Op([=](nxt_Completion done, void *ctx) { 
+    return nxp_GetEvent(pump, handle, event, maxBytes, done, ctx); 
+  }); 
+} 
+ 
+} /* namespace nx */ 
+ 
+#endif /* _nxpump_hpp_ */
@@ -0,0 +1,226 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxrate.h 
+ 
+  Synopsis: 
+    Definitions of the trace rate controller, which keeps the trace stream 
+    just under the capacity of the port by adjusting DTM ranges, BTM 
+    triggers and the overrun delay, and reports every change it makes 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxrate_h_ 
+#define _nxrate_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+ 
+/* +--------------------+ 
+   | rate control types | 
+   +--------------------+ */ 
+ 
+/* nxt_AddrRange: a range of target addresses 
+    - (addr >= startAddr) && (addr < endAddr), as for nxt_SetEvent.u.dtm 
+*/ 
+typedef struct { 
+  nxvt_Address startAddr; 
+  nxvt_Address endAddr; 
+} nxt_AddrRange; 
+ 
+ 
+/* nxt_RateCuts: how far an event may be cut 
+    - for DTM events, core is the range kept when the event is narrowed, 
+        used if canNarrow != 0 
+    - for BTM events, gateStartTriggerId and gateEndTriggerId replace the 
+        event's own triggers while it is gated; if both are 0, gating 
+        clears the BTM event altogether 
+*/ 
+typedef struct { 
+  int canNarrow; 
+  nxt_AddrRange core; 
+  int gateStartTriggerId;  /* disabled == 0, else = event id */ 
+  int gateEndTriggerId;    /* disabled == 0, else = event id */ 
+} nxt_RateCuts; 
+ 
+ 
+/* nxt_RateLimits: defines when the controller acts 
+    - fill is the emulator's event queue level, read with 
+        NX_CTRL_QUEUE_LEVEL, in percent of its size; it is measured only 
+        if the target supports that control 
+    - lag is how far the host is behind the target, in microseconds: for 
+        a message read at host time h with timestamp t, d = h - t * 1000000 
+        / tstampHz, and lag is d less the smallest d seen so far, i.e. 
+        relative to the message delivered fastest; it is measured only if 
+        maxLag > 0 and tstampHz > 0, and the smallest d is forgotten when 
+        TSTAMP goes backwards 
+    - the controller cuts trace when any measured condition is over its 
+        limit (fill > highWater, lag > maxLag) or the target reports an 
+        overrun, and restores it when every measured condition is under 
+        its limit (fill < lowWater, lag < maxLag / 2) and no overrun was 
+        reported for quietTime 
+    - with neither fill nor lag measured, it cuts on each overrun and 
+        restores after quietTime without one 
+*/ 
+typedef struct { 
+  int highWater;           /* percent */ 
+  int lowWater;            /* percent, < highWater */ 
+  long maxLag;             /* microseconds, 0 to ignore lag */ 
+  unsigned long tstampHz;  /* TSTAMP counts per second, 0 to ignore lag */ 
+  long quietTime;          /* microseconds without overrun before restoring */ 
+  int maxOverrunDelay;     /* largest NX_CTRL_OVERRUN_MODE delay, 0 for none */ 
+  long holdOff;            /* microseconds between two changes */ 
+} nxt_RateLimits; 
+ 
+ 
+/* nxt_RateAction: the changes the controller can make, in the order it 
+    makes them when cutting trace; restoring undoes them in reverse 
+*/ 
+typedef enum { 
+  NXR_DTM_NARROW   = 0x1,  /* a DTM range reduced to its core range */ 
+  NXR_DTM_DISABLE  = 0x2,  /* a DTM range cleared */ 
+  NXR_BTM_GATE     = 0x3,  /* BTM limited to its gate triggers */ 
+  NXR_DELAY        = 0x4,  /* overrun delay raised */ 
+  NXR_DTM_WIDEN    = 0x11, /* a narrowed DTM range restored */ 
+  NXR_DTM_ENABLE   = 0x12, /* a cleared DTM range set again */ 
+  NXR_BTM_UNGATE   = 0x13, /* BTM triggers restored */ 
+  NXR_UNDELAY      = 0x14, /* overrun delay lowered */ 
+  NXR_OVERRUN      = 0x20  /* messages lost by the target, not a change */ 
+} nxt_RateAction; 
+ 
+ 
+/* nxt_RateReport: one change made by the controller, or one overrun 
+    - the gap of a cut is the range of eid no longer traced, from 
+        timestamp until the matching restore 
+    - for NXR_OVERRUN, numLost is the number of messages the target 
+        reported as lost, or -1 if it does not say 
+*/ 
+typedef struct { 
+  nxt_RateAction action; 
+  unsigned long long timestamp;  /* TSTAMP of the last message before it */ 
+  int eid;                       /* event changed, 0 for delay/overrun */ 
+  nxt_AddrRange range;           /* no longer traced (cuts) or traced */ 
+                                 /*   again (restores) */ 
+  int delay;                     /* overrun delay after the change */ 
+  int fill;                      /* queue level that caused the change, */ 
+                                 /*   -1 if not measured */ 
+  long lag;                      /* lag that caused the change, */ 
+                                 /*   -1 if not measured */ 
+  long numLost; 
+} nxt_RateReport; 
+ 
+ 
+/* nxt_RateControl: an opaque reference to a rate controller 
+*/ 
+typedef struct nxt_RateControlTag nxt_RateControl; 
+ 
+ 
+/* +-------------------------------------------+ 
+   | nxr_Create() - Create a Rate Controller   | 
+   +-------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - limits defines when the controller acts 
+     - report is called with ctx for every nxt_RateReport 
+ 
+   Postconditions: 
+     if succeeds, returns the controller, otherwise NULL 
+ 
+   Notes: 
+     Without NX_CTRL_QUEUE_LEVEL the controller works from lag and 
+     overrun messages alone, as given in nxt_RateLimits. 
+*/ 
+ 
+nxt_RateControl *nxr_Create (nxt_Handle *handle, 
+                             const nxt_RateLimits *limits, 
+                             void (*report)(void *ctx, 
+                                            const nxt_RateReport *r), 
+                             void *ctx); 
+ 
+ 
+/* +-------------------------------------------+ 
+   | nxr_Destroy() - Destroy a Rate Controller | 
+   +-------------------------------------------+ 
+ 
+   Preconditions: 
+     - ctl is from a successful invocation of nxr_Create 
+ 
+   Postconditions: 
+     - every cut is restored, and reported, and the controller deallocated 
+*/ 
+ 
+void nxr_Destroy (nxt_RateControl *ctl); 
+ 
+ 
+/* +--------------------------------------------------+ 
+   | nxr_SetEvent() - Set a Trace Event under Control | 
+   +--------------------------------------------------+ 
+ 
+   Preconditions: 
+     - ctl is from a successful invocation of nxr_Create 
+     - setEvent is an NX_ETYPE_DTM or NX_ETYPE_BTM event, as for nx_SetEvent 
+     - priority orders the events; the lowest is cut first 
+     - cuts defines how far the event may be cut, or is NULL if it may 
+         only be cleared 
+ 
+   Postconditions: 
+     as for nx_SetEvent; the event is then owned by the controller until 
+       nxr_ClearEvent 
+*/ 
+ 
+nxt_Status nxr_SetEvent (nxt_RateControl *ctl, 
+                         const nxt_SetEvent *setEvent, 
+                         const int priority, 
+                         const nxt_RateCuts *cuts); 
+ 
+ 
+/* +------------------------------------------------------+ 
+   | nxr_ClearEvent() - Clear a Trace Event under Control | 
+   +------------------------------------------------------+ 
+ 
+   Preconditions: 
+     - ctl is from a successful invocation of nxr_Create 
+     - eid is from nxr_SetEvent 
+ 
+   Postconditions: 
+     - as for nx_ClearEvent 
+*/ 
+ 
+void nxr_ClearEvent (nxt_RateControl *ctl, const int eid); 
+ 
+ 
+/* +-------------------------------------------------+ 
+   | nxr_GetEvent() - Read an Event and Control Rate | 
+   +-------------------------------------------------+ 
+ 
+   Preconditions: 
+     - as for nx_GetEvent, with ctl in place of the handle 
+ 
+   Postconditions: 
+     as for nx_GetEvent; before returning, the controller samples the 
+       queue level and lag and, at most once per holdOff, makes one change 
+       and reports it 
+ 
+   Notes: 
+     One change per holdOff, with the gap between lowWater and highWater, 
+     keeps the controller from oscillating.  Cuts are made lowest priority 
+     first in the order of nxt_RateAction; the overrun delay is only used 
+     once every event has been cut as far as it can be. 
+*/ 
+ 
+nxt_Status nxr_GetEvent (nxt_RateControl *ctl, nxt_ReceivedEvent *event, 
+                         int maxBytes, const int block); 
+ 
+#endif /* _nxrate_h_ */
@@ -0,0 +1,208 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxsnap.h 
+ 
+  Synopsis: 
+    Definitions of target memory snapshots: capture transfers only the pages 
+    changed since a baseline, and snapshots are kept in a store of 
+    content addressed, deduplicated pages 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxsnap_h_ 
+#define _nxsnap_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+ 
+/* version string for v1.0 of the snapshot store layout 
+*/ 
+#define NXS_VERSION_STRING_10 "nxSnapv1.0" 
+ 
+ 
+/* +----------------+ 
+   | snapshot types | 
+   +----------------+ */ 
+ 
+/* NXS_DIGEST_SIZE: bytes in a page or snapshot digest (SHA-256) 
+*/ 
+#define NXS_DIGEST_SIZE (32) 
+ 
+ 
+/* nxt_SnapshotId: names a snapshot in a store; it is the digest of the 
+    snapshot's region list and page digests, so equal states share an id 
+    - the index of a snapshot holds a reference count: each nxs_Capture 
+        that yields the id adds one, each nxs_Delete of it removes one 
+*/ 
+typedef struct { 
+  unsigned char digest[NXS_DIGEST_SIZE]; 
+} nxt_SnapshotId; 
+ 
+ 
+/* nxt_MemRegion: a range of target memory to be captured 
+    - addr and numBytes are multiples of the store's page size 
+*/ 
+typedef struct { 
+  int map; 
+  int accessPriority; 
+  int accessSize; 
+  nxvt_Address addr; 
+  size_t numBytes; 
+} nxt_MemRegion; 
+ 
+ 
+/* nxt_SnapshotStats: what a capture or restore transferred 
+*/ 
+typedef struct { 
+  int numPages;            /* pages in the snapshot */ 
+  int numPagesRead;        /* pages read with nx_ReadMem */ 
+  int numPagesWritten;     /* pages written with nx_WriteMem */ 
+  int numPagesStored;      /* pages not already in the store */ 
+  int numTransfers;        /* nx_ReadMem/nx_WriteMem calls issued */ 
+  int usedTargetChecksums; /* != 0 if NX_CTRL_PAGE_CHECKSUM was available */ 
+} nxt_SnapshotStats; 
+ 
+ 
+/* nxt_SnapshotStore: an opaque reference to an open store 
+*/ 
+typedef struct nxt_SnapshotStoreTag nxt_SnapshotStore; 
+ 
+ 
+/* +------------------------------------------+ 
+   | nxs_OpenStore() - Open a Snapshot Store  | 
+   +------------------------------------------+ 
+ 
+   Preconditions: 
+     - path names the store directory, which is created if need be 
+     - pageSize is the page size in bytes, a power of 2; it must match 
+         the page size of an existing store 
+ 
+   Postconditions: 
+     if succeeds, returns the store and sets status to NX_ERROR_NONE 
+     otherwise returns NULL and sets status to NX_ERROR_FAILED 
+ 
+   Notes: 
+     Each page is stored once, in a file named by the hex digest of its 
+     contents.  A snapshot is a small index file listing its regions and 
+     the digest and CRC-32 of each page, so a checkpoint which changes a 
+     few pages costs a few pages plus its index. 
+*/ 
+ 
+nxt_SnapshotStore *nxs_OpenStore (const char *path, const int pageSize, 
+                                  nxt_Status *status); 
+ 
+ 
+/* +--------------------------------------------+ 
+   | nxs_CloseStore() - Close a Snapshot Store  | 
+   +--------------------------------------------+ 
+ 
+   Preconditions: 
+     - store is from a successful invocation of nxs_OpenStore 
+ 
+   Postconditions: 
+     - the store is flushed and deallocated 
+*/ 
+ 
+void nxs_CloseStore (nxt_SnapshotStore *store); 
+ 
+ 
+/* +---------------------------------------------+ 
+   | nxs_Capture() - Capture a Target Snapshot   | 
+   +---------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - store is from a successful invocation of nxs_OpenStore 
+     - regions points to numRegions regions to capture 
+     - baseline is a snapshot of the same regions, or NULL to read 
+         every page 
+     - id points to where the new snapshot's id will be stored 
+     - stats points to where the figures will be stored, or is NULL 
+ 
+   Postconditions: 
+     if succeeds, the snapshot is in the store, *id names it and 
+       NX_ERROR_NONE is returned; if the store already held a snapshot 
+       of the same state, its index gains a reference instead 
+     else may invoke the error callback installed with nx_Open, then 
+       returns NX_ERROR_FAILED and the store is unchanged 
+ 
+   Notes: 
+     With a baseline, the TAL asks the target for a CRC-32 of every page 
+     with NX_CTRL_PAGE_CHECKSUM (the variant is given there) and reads 
+     only the pages whose checksum differs from the baseline's.  Runs of 
+     such pages are read with one nx_ReadMem each.  If the control 
+     returns NX_ERROR_NO_CAPABILITY, every page is read and the store 
+     still deduplicates them. 
+     The target should be halted while a snapshot is captured. 
+*/ 
+ 
+nxt_Status nxs_Capture (nxt_Handle *handle, 
+                        nxt_SnapshotStore *store, 
+                        const nxt_MemRegion *regions, const int numRegions, 
+                        const nxt_SnapshotId *baseline, 
+                        nxt_SnapshotId *id, 
+                        nxt_SnapshotStats *stats); 
+ 
+ 
+/* +---------------------------------------------+ 
+   | nxs_Restore() - Restore a Target Snapshot   | 
+   +---------------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open 
+     - store is from a successful invocation of nxs_OpenStore 
+     - id names a snapshot in the store 
+     - current names the snapshot the target is known to hold, or is NULL 
+     - stats points to where the figures will be stored, or is NULL 
+ 
+   Postconditions: 
+     if succeeds, the target's memory in the snapshot's regions holds the 
+       snapshot and NX_ERROR_NONE is returned 
+     else may invoke the error callback installed with nx_Open, then 
+       returns NX_ERROR_FAILED 
+ 
+   Notes: 
+     Only pages whose digest differs from current (or, when current is 
+     NULL, whose target checksum differs) are written, and runs of such 
+     pages are written with one nx_WriteMem each.  If current is NULL 
+     and NX_CTRL_PAGE_CHECKSUM returns NX_ERROR_NO_CAPABILITY, every page 
+     of the snapshot is written. 
+*/ 
+ 
+nxt_Status nxs_Restore (nxt_Handle *handle, 
+                        nxt_SnapshotStore *store, 
+                        const nxt_SnapshotId *id, 
+                        const nxt_SnapshotId *current, 
+                        nxt_SnapshotStats *stats); 
+ 
+ 
+/* +---------------------------------------------+ 
+   | nxs_Delete() - Remove a Snapshot            | 
+   +---------------------------------------------+ 
+ 
+   Preconditions: 
+     - store is from a successful invocation of nxs_OpenStore 
+     - id names a snapshot in the store 
+ 
+   Postconditions: 
+     - one reference to the snapshot is removed; when it was the last, 
+         the index is removed, and so is every page no other snapshot 
+         refers to 
+     - returned status indicates whether the store could be updated 
+*/ 
+ 
+nxt_Status nxs_Delete (nxt_SnapshotStore *store, const nxt_SnapshotId *id); 
+ 
+#endif /* _nxsnap_h_ */
@@ -60,7 +60,8 @@ typedef enum {
   NX_ERROR_NONE          = 0, /* success */ 
   NX_ERROR_FAILED        = 1, /* generic failure */ 
   NX_ERROR_NO_CAPABILITY = 2, /* operation not within capabilities */ 
-  NX_ERROR_NO_SPACE      = 3  /* insufficient buffer space */                   
+  NX_ERROR_NO_SPACE      = 3, /* insufficient buffer space */                   
+  NX_ERROR_NO_EVENT      = 4  /* no event yet, see nxpump.h */ 
 } nxt_Status; 
  
  
@@ -254,7 +255,7 @@ typedef enum {
     what a watchpoint should match against 
 */ 
 typedef enum { 
-  NX_WATCHPOINT_DATAADDR 
+  NX_WATCHPOINT_DATAADDR, 
   NX_WATCHPOINT_DATAVALUE, 
   NX_WATCHPOINT_DATAADDR_AND_DATAVALUE, 
   NX_WATCHPOINT_INSTRADDR 
@@ -76,12 +76,46 @@ typedef float t_FloatRegister;
 typedef struct { 
   t_IntegerRegister intRegs[NUM_INT_REGS]; 
   t_FloatRegister floatRegs[NUM_FLOAT_REGS];  
+  nxvt_Address pc;          /* program counter, see nxevent.h */ 
 } nxvt_Registers; 
  
+/*################################################################ 
+  ### definitions for extra target setup 
+  ###   (see nxt_TargetSpec and nx_Open) 
+  ### this example adds the clock rate of the access port 
+  ################################################################*/ 
+ 
+/* nxvt_VendorDefinedTargetSpec: information for vendor defined 
+    target setup 
+*/ 
+typedef struct { 
+  long portClockHz;       /* 0 for the probe's default */ 
+} nxvt_VendorDefinedTargetSpec; 
+ 
+/*################################################################ 
+  ### definitions for software breakpoints 
+  ###   (see nxe_Commit in nxevent.h) 
+  ### this example uses an unconditional trap instruction 
+  ################################################################*/ 
+ 
+/* NXVT_SWBREAK_SIZE: bytes in a software breakpoint instruction, which 
+    is also its alignment 
+*/ 
+#define NXVT_SWBREAK_SIZE (4) 
+ 
+/* NXVT_SWBREAK_OPCODE_BIG, NXVT_SWBREAK_OPCODE_LITTLE: initialisers for 
+    the bytes of the software breakpoint instruction (PowerPC trap, 
+    0x7fe00008), in ascending address order, for a target whose 
+    cap.targetEndian is NX_ENDIAN_BIG or NX_ENDIAN_LITTLE respectively 
+*/ 
+#define NXVT_SWBREAK_OPCODE_BIG    { 0x7f, 0xe0, 0x00, 0x08 } 
+#define NXVT_SWBREAK_OPCODE_LITTLE { 0x08, 0x00, 0xe0, 0x7f } 
+ 
 /*################################################################ 
   ### definitions for some extra vendor defined control operations  
   ###   (see nxt_CtrlTag, nxt_CtrlData, and nx_Ioctl) 
-  ### this example adds a LED flashing, and trace config features 
+  ### this example adds a LED flashing, trace config, memory page  
+  ### checksum, event queue level, and link compression features 
   ################################################################*/ 
  
 /* NX_CTRL_FLASH_LED: tag value for the LED control operations  
@@ -93,6 +127,36 @@ typedef struct {
 */ 
 #define NX_CTRL_CONFIG_TRACEBUF (0x101) 
  
+/* NX_CTRL_PAGE_CHECKSUM:  
+    tag value for the memory page checksum operation (see nxsnap.h);  
+    each checksum is the CRC-32 of IEEE 802.3, as computed by zlib's  
+    crc32 (polynomial 0x04c11db7, reflected, initial value and final  
+    xor 0xffffffff), of the page's bytes in ascending address order,  
+    whatever the target's byte order or access size  
+*/ 
+#define NX_CTRL_PAGE_CHECKSUM (0x102) 
+ 
+/* NX_CTRL_QUEUE_LEVEL:  
+    tag value for reading the emulator's event queue level (see nxrate.h)  
+*/ 
+#define NX_CTRL_QUEUE_LEVEL (0x103) 
+ 
+/* NX_CTRL_COMPRESSION:  
+    tag value for selecting link compression (see nxcomp.h)  
+*/ 
+#define NX_CTRL_COMPRESSION (0x104) 
+ 
+/* NX_CTRL_LINK_MODEL:  
+    tag value for setting the link speed of a simulated HAL  
+*/ 
+#define NX_CTRL_LINK_MODEL (0x105) 
+ 
+/* NX_CTRL_NO_EVENT: 
+    tag value for asking whether the TAL returns NX_ERROR_NO_EVENT (see 
+    nxpump.h); takes no data, and returns NX_ERROR_NONE if it does 
+*/ 
+#define NX_CTRL_NO_EVENT (0x106) 
+ 
  
 /* nxvt_VendorDefinedCtrlData:  information for 
      vendor defined control operations (see nx_Ioctl) 
@@ -105,6 +169,24 @@ typedef struct {
     struct { 
       int traceBufferSize; 
     } configureTraceBuffer; /* if cTag == NX_CTRL_CONFIG_TRACEBUF */ 
+    struct { 
+      int map; 
+      nxvt_Address addr;    /* first page, aligned to pageSize */ 
+      int pageSize;         /* bytes per page, a power of 2 */ 
+      int numPages; 
+      unsigned long *checksums; /* host buffer for numPages CRC-32 values */ 
+    } pageChecksum;         /* if cTag == NX_CTRL_PAGE_CHECKSUM */ 
+    struct { 
+      int *bytesQueued;     /* host variable for the bytes waiting */ 
+      int *queueSize;       /* host variable for the queue's size in bytes */ 
+    } queueLevel;           /* if cTag == NX_CTRL_QUEUE_LEVEL */ 
+    struct { 
+      int codecs;           /* NX_COMPRESS_ bits the TAL may choose from */ 
+    } compression;          /* if cTag == NX_CTRL_COMPRESSION */ 
+    struct { 
+      long bytesPerSecond;  /* 0 for unlimited */ 
+      long latency;         /* microseconds added to each transfer */ 
+    } linkModel;            /* if cTag == NX_CTRL_LINK_MODEL */ 
   } u; 
 } nxvt_VendorDefinedCtrlData; 
  
@@ -0,0 +1,332 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxwatch.h 
+ 
+  Synopsis: 
+    Definitions of the variable watch: decodes data trace (DTM) messages 
+    into typed (variable, value, timestamp) records and hands them to 
+    subscribers in columnar batches 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxwatch_h_ 
+#define _nxwatch_h_ 
+ 
+/* Include the standard NEXUS API data types 
+*/ 
+#include "nxtypes.h" 
+ 
+/* Include the daemon's shared trace ring types, see nxw_DecodeShm 
+*/ 
+#include "nxdaemon.h" 
+ 
+ 
+/* +-------------+ 
+   | watch types | 
+   +-------------+ */ 
+ 
+/* nxt_VarType: how the bytes of a variable are to be decoded 
+*/ 
+typedef enum { 
+  NXW_TYPE_INT8, 
+  NXW_TYPE_UINT8, 
+  NXW_TYPE_INT16, 
+  NXW_TYPE_UINT16, 
+  NXW_TYPE_INT32, 
+  NXW_TYPE_UINT32, 
+  NXW_TYPE_INT64, 
+  NXW_TYPE_UINT64, 
+  NXW_TYPE_FLOAT32, 
+  NXW_TYPE_FLOAT64 
+} nxt_VarType; 
+ 
+ 
+/* data trace TCODEs handled by nxw_Decode (see Appendix B) 
+*/ 
+#define NXW_TCODE_DATA_WRITE      (5) 
+#define NXW_TCODE_DATA_READ       (6) 
+#define NXW_TCODE_ERROR           (8) 
+#define NXW_TCODE_DATA_WRITE_SYNC (13) 
+#define NXW_TCODE_DATA_READ_SYNC  (14) 
+ 
+ 
+/* nxt_WatchSymbol: a variable to be watched 
+    - symbols must not overlap; size follows from type 
+*/ 
+typedef struct { 
+  const char *name; 
+  nxvt_Address addr; 
+  nxt_VarType type; 
+} nxt_WatchSymbol; 
+ 
+ 
+/* nxt_WatchValue: a decoded value 
+    - i holds the signed integer types, sign extended 
+    - u holds the unsigned integer types, zero extended 
+    - f holds the float types 
+*/ 
+typedef union { 
+  nxvt_Word i; 
+  unsigned long long u; 
+  double f; 
+} nxt_WatchValue; 
+ 
+ 
+/* nxt_WatchBatch: records delivered to a subscriber, one column per field 
+    - record n is (var[n], value[n], timestamp[n]); var is an index into 
+        the symbol list given to nxw_Create 
+    - the columns are only valid during the subscriber's callback 
+*/ 
+typedef struct { 
+  int count; 
+  const int *var; 
+  const nxt_WatchValue *value; 
+  const unsigned long long *timestamp; 
+} nxt_WatchBatch; 
+ 
+ 
+/* nxt_Watch: an opaque reference to a variable watch 
+*/ 
+typedef struct nxt_WatchTag nxt_Watch; 
+ 
+ 
+/* +-------------------------------------+ 
+   | nxw_Create() - Create a Watch       | 
+   +-------------------------------------+ 
+ 
+   Preconditions: 
+     - handle is from a successful invocation of nx_Open; its cap and 
+         targetEndian are used for decoding 
+     - symbols points to numSymbols variables, in any order 
+ 
+   Postconditions: 
+     if succeeds, returns the watch and sets status to NX_ERROR_NONE 
+     if two symbols overlap, returns NULL and sets status to NX_ERROR_FAILED 
+     the host copy of every variable (see nxw_Decode) is all zero bytes 
+ 
+   Notes: 
+     The symbols are sorted into an interval index.  The start addresses 
+     are held in one array in breadth first (Eytzinger) order, so a lookup 
+     walks down an implicit tree whose top levels share a few cache lines, 
+     and the ends, types and symbol indexes are kept in a parallel array 
+     touched once per lookup.  Decoding a record costs O(log numSymbols) 
+     with no pointer chasing. 
+*/ 
+ 
+nxt_Watch *nxw_Create (nxt_Handle *handle, 
+                       const nxt_WatchSymbol *symbols, const int numSymbols, 
+                       nxt_Status *status); 
+ 
+ 
+/* +-------------------------------------+ 
+   | nxw_Destroy() - Destroy a Watch     | 
+   +-------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+ 
+   Postconditions: 
+     - the watch and its subscriptions are deallocated; the DTM events set 
+         from nxw_GetDTMEvents are not cleared 
+*/ 
+ 
+void nxw_Destroy (nxt_Watch *watch); 
+ 
+ 
+/* +-----------------------------------------------------+ 
+   | nxw_GetDTMEvents() - Find the DTM Ranges to be Set  | 
+   +-----------------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+     - events points to room for maxEvents events 
+     - numEvents points to where the number of events will be stored 
+ 
+   Postconditions: 
+     - events[0..*numEvents-1] are NX_ETYPE_DTM write events, with eids 
+         from dtmMinEventId upwards, which together cover every symbol; 
+         they are ready to pass to nx_SetEvent 
+     - returns NX_ERROR_NO_CAPABILITY if the target has no DTM 
+ 
+   Notes: 
+     If there are more symbols than DTM events, neighbouring symbols are 
+     covered by one range, merging first across the smallest gaps so as 
+     to trace as few unwatched bytes as possible. 
+*/ 
+ 
+nxt_Status nxw_GetDTMEvents (nxt_Watch *watch, 
+                             nxt_SetEvent *events, const int maxEvents, 
+                             int *numEvents); 
+ 
+ 
+/* +-----------------------------------------------+ 
+   | nxw_Subscribe() - Subscribe to Watch Records  | 
+   +-----------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+     - vars points to numVars symbol indexes, or is NULL for every symbol 
+     - batchSize is the number of records gathered before deliver is called 
+     - deliver is called with ctx and each full batch 
+ 
+   Postconditions: 
+     if succeeds, returns a subscription ID > 0, otherwise 0 
+*/ 
+ 
+int nxw_Subscribe (nxt_Watch *watch, 
+                   const int *vars, const int numVars, 
+                   const int batchSize, 
+                   void (*deliver)(void *ctx, const nxt_WatchBatch *batch), 
+                   void *ctx); 
+ 
+ 
+/* +---------------------------------------------------+ 
+   | nxw_Unsubscribe() - Cancel a Watch Subscription   | 
+   +---------------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+     - sid is from nxw_Subscribe on the same watch 
+ 
+   Postconditions: 
+     - the subscription's pending records are dropped and deliver is not 
+         called again 
+*/ 
+ 
+void nxw_Unsubscribe (nxt_Watch *watch, const int sid); 
+ 
+ 
+/* +-----------------------------------------------+ 
+   | nxw_Decode() - Decode a Data Trace Message    | 
+   +-----------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+     - event is from nx_GetEvent on the watch's handle 
+ 
+   Postconditions: 
+     - returns the number of records produced; only data write messages 
+         to watched addresses produce records 
+     - subscribers whose batch filled up have been called 
+ 
+   Notes: 
+     Data trace messages are expected as the packets TCODE, SRC, DSZ, 
+     address, DATA and, if present, TSTAMP.  The watch keeps the address 
+     base of Nexus address compression, shared by data reads and writes: 
+       - NXW_TCODE_DATA_WRITE_SYNC and NXW_TCODE_DATA_READ_SYNC carry a 
+           full address (F-ADDR), which becomes the base 
+       - NXW_TCODE_DATA_WRITE and NXW_TCODE_DATA_READ carry U-ADDR; the 
+           address is U-ADDR XOR base, and becomes the base 
+       - NXW_TCODE_ERROR (e.g. an overrun), or an event lost between two 
+           calls as reported by the caller with nxw_Reset, invalidates 
+           the base: compressed messages are then dropped, and counted 
+           by nxw_NumDropped, until the next sync message 
+     Other messages leave the base alone.  A write spanning several 
+     variables is split at their boundaries; a write to part of a 
+     variable updates a host copy of it and the whole value is decoded 
+     from that copy.  The copies start as zero, so until a variable has 
+     been written whole, or read with nxw_Load, the bytes a partial write 
+     does not cover decode as zero.  Without TSTAMP the timestamp is 
+     the running count of messages decoded. 
+*/ 
+ 
+int nxw_Decode (nxt_Watch *watch, const nxt_ReceivedEvent *event); 
+ 
+ 
+/* +----------------------------------------------------+ 
+   | nxw_DecodeShm() - Decode a Message from a Daemon   | 
+   +----------------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create on a handle 
+         from nxd_Attach 
+     - event is from nxd_ReadTrace, and not yet released 
+ 
+   Postconditions: 
+     - as for nxw_Decode 
+ 
+   Notes: 
+     The packets are read in place through NXD_SHM_PTR, so the daemon's 
+     trace ring feeds the watch without a copy.  If nxd_ReleaseTrace then 
+     reports that the slot was overwritten, the records taken from it are 
+     already delivered; call nxw_Reset, as for any lost message. 
+*/ 
+ 
+int nxw_DecodeShm (nxt_Watch *watch, const nxt_ShmEvent *event); 
+ 
+ 
+/* +--------------------------------------------------+ 
+   | nxw_Load() - Read the Watched Variables' Values  | 
+   +--------------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+     - the target is halted, or the variables are not written meanwhile 
+ 
+   Postconditions: 
+     - the host copy of every variable is read from the target with 
+         nx_ReadMem, one call per run of adjacent symbols; no records are 
+         produced 
+     - returns NX_ERROR_NONE, or NX_ERROR_FAILED if a read failed, in 
+         which case the copies of the variables not read are unchanged 
+*/ 
+ 
+nxt_Status nxw_Load (nxt_Watch *watch); 
+ 
+ 
+/* +----------------------------------------------+ 
+   | nxw_Reset() - Report a Gap in the Messages   | 
+   +----------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+ 
+   Postconditions: 
+     - the address base is invalid until the next sync message, as after 
+         NXW_TCODE_ERROR; call it when messages were lost on the host 
+         side, e.g. when nxd_ReadTrace reports an overrun or 
+         nxd_ReleaseTrace a slot overwritten while read 
+*/ 
+ 
+void nxw_Reset (nxt_Watch *watch); 
+ 
+ 
+/* +-----------------------------------------------+ 
+   | nxw_NumDropped() - Count Undecodable Messages | 
+   +-----------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+ 
+   Postconditions: 
+     - returns the number of data trace messages dropped so far for want 
+         of a valid address base 
+*/ 
+ 
+unsigned long nxw_NumDropped (nxt_Watch *watch); 
+ 
+ 
+/* +--------------------------------------------+ 
+   | nxw_Flush() - Deliver Partial Batches      | 
+   +--------------------------------------------+ 
+ 
+   Preconditions: 
+     - watch is from a successful invocation of nxw_Create 
+ 
+   Postconditions: 
+     - every subscriber with pending records has been called 
+*/ 
+ 
+void nxw_Flush (nxt_Watch *watch); 
+ 
+#endif /* _nxwatch_h_ */
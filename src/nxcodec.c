@@ -0,0 +1,445 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec.c 
+ 
+  Synopsis: 
+    Optimised codecs of nxcodec.h: the MSEO codes are scanned 16 at a 
+    time with SSE2 where the compiler offers it, and MDO, packet and NRR 
+    bits are moved through a 64 bit accumulator rather than one by one; 
+    tests/ checks every result against nxcodec_ref.c 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#include <string.h> 
+ 
+#include "nxcodec.h" 
+ 
+#if defined(__SSE2__) 
+#include <emmintrin.h> 
+#endif 
+ 
+ 
+static int validMdoBits (int mdoBits) 
+{ 
+  return mdoBits == 1 || mdoBits == 2 || mdoBits == 4 || mdoBits == 6 || 
+         mdoBits == 8 || mdoBits == 12 || mdoBits == 16; 
+} 
+ 
+ 
+/* +---------------------+ 
+   | MSEO scans          | 
+   +---------------------+ */ 
+ 
+/* findEnd: index of the first NX_MSEO_END_MESSAGE code at or after i, 
+    or n if there is none; *bad is set if a code before it, or any code 
+    when there is none, is not an nxt_MSEO 
+*/ 
+static size_t findEnd (const unsigned char *mseo, size_t i, size_t n, 
+                       int *bad) 
+{ 
+  *bad = 0; 
+#if defined(__SSE2__) 
+  { 
+    const __m128i end = _mm_set1_epi8(NX_MSEO_END_MESSAGE); 
+    const __m128i pkt = _mm_set1_epi8(NX_MSEO_END_PACKET); 
+    const __m128i zero = _mm_setzero_si128(); 
+ 
+    for (; i + 16 <= n; i += 16) { 
+      __m128i v = _mm_loadu_si128((const __m128i *)(mseo + i)); 
+      int isEnd = _mm_movemask_epi8(_mm_cmpeq_epi8(v, end)); 
+      int isValid = _mm_movemask_epi8( 
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, zero), 
+                                  _mm_cmpeq_epi8(v, pkt)), 
+                     _mm_cmpeq_epi8(v, end))); 
+ 
+      if (isEnd) { 
+        int k = 0; 
+ 
+        while (!(isEnd & (1 << k))) 
+          k++; 
+        if ((~isValid) & ((1 << k) - 1)) 
+          *bad = 1; 
+        return i + k; 
+      } 
+      if (isValid != 0xffff) 
+        *bad = 1; 
+    } 
+  } 
+#endif 
+  for (; i < n; i++) { 
+    if (mseo[i] == NX_MSEO_END_MESSAGE) 
+      return i; 
+    if (mseo[i] != NX_MSEO_NORMAL && mseo[i] != NX_MSEO_END_PACKET) 
+      *bad = 1; 
+  } 
+  return n; 
+} 
+ 
+/* findMark: index of the first NX_MSEO_END_PACKET code in [i, e), or e 
+*/ 
+static size_t findMark (const unsigned char *mseo, size_t i, size_t e) 
+{ 
+#if defined(__SSE2__) 
+  const __m128i pkt = _mm_set1_epi8(NX_MSEO_END_PACKET); 
+ 
+  for (; i + 16 <= e; i += 16) { 
+    int m = _mm_movemask_epi8( 
+      _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(mseo + i)), pkt)); 
+ 
+    if (m) { 
+      int k = 0; 
+ 
+      while (!(m & (1 << k))) 
+        k++; 
+      return i + k; 
+    } 
+  } 
+#endif 
+  for (; i < e; i++) 
+    if (mseo[i] == NX_MSEO_END_PACKET) 
+      return i; 
+  return e; 
+} 
+ 
+ 
+/* +---------------------+ 
+   | AUX decoder         | 
+   +---------------------+ */ 
+ 
+/* getBits: copies n bits, from bit off of the transfers at mdo, to out 
+    in packet bit order, the bits of the last byte above n being zero; 
+    reads no transfer past the one holding the last bit 
+*/ 
+static void getBits (const unsigned short *mdo, const int mdoBits, 
+                     size_t off, size_t n, unsigned char *out) 
+{ 
+  const unsigned mask = (1u << mdoBits) - 1; 
+  size_t t = off / mdoBits; 
+  unsigned long long acc; 
+  int accBits; 
+  size_t done = 0; 
+ 
+  if (n == 0) 
+    return; 
+  acc = (mdo[t++] & mask) >> (off % mdoBits); 
+  accBits = mdoBits - (int)(off % mdoBits); 
+  while (done < n) { 
+    size_t want = n - done; 
+ 
+    while ((size_t)accBits < want && accBits <= 48) { 
+      acc |= (unsigned long long)(mdo[t++] & mask) << accBits; 
+      accBits += mdoBits; 
+    } 
+    if (want >= 8) { 
+      while (accBits >= 8 && n - done >= 8) { 
+        out[done / 8] = (unsigned char)acc; 
+        acc >>= 8; 
+        accBits -= 8; 
+        done += 8; 
+      } 
+    } else { 
+      out[done / 8] = (unsigned char)(acc & ((1u << want) - 1)); 
+      done = n; 
+    } 
+  } 
+} 
+ 
+/* fastMessage: the packets of one message, as found by fastParse 
+*/ 
+typedef struct { 
+  int numPackets; 
+  size_t start[NX_MAX_PACKETS]; 
+  size_t numBits[NX_MAX_PACKETS]; 
+} fastMessage; 
+ 
+/* fastParse: split the message in transfers first..last into packets, 
+    working on bit offsets from the message start rather than on single 
+    bits; returns 0 if the message is malformed 
+*/ 
+static int fastParse (const nxt_PacketLayout *layout, 
+                      const nxt_AuxStream *stream, 
+                      size_t first, size_t last, fastMessage *msg) 
+{ 
+  const int mdoBits = stream->mdoBits; 
+  const size_t L = (last - first + 1) * (size_t)mdoBits; 
+  const size_t none = (size_t)-1; 
+  const nxt_MessageLayout *ml; 
+  size_t mark = findMark(stream->mseo, first, last); 
+  size_t markBit = (mark < last) ? (mark - first + 1) * mdoBits : none; 
+  size_t off; 
+  unsigned char tcode = 0; 
+  int p; 
+ 
+  if (L < NX_TCODE_BITS || markBit <= NX_TCODE_BITS) 
+    return 0; 
+  getBits(stream->mdo + first, mdoBits, 0, NX_TCODE_BITS, &tcode); 
+  ml = &layout->tcode[tcode]; 
+  if (ml->numPackets < 1 || ml->numPackets > NX_MAX_PACKETS) 
+    return 0; 
+  msg->numPackets = ml->numPackets; 
+  msg->start[0] = 0; 
+  msg->numBits[0] = NX_TCODE_BITS; 
+  off = NX_TCODE_BITS; 
+ 
+  for (p = 1; p < ml->numPackets; p++) { 
+    const int lastPacket = (p == ml->numPackets - 1); 
+    size_t end; 
+ 
+    if (ml->numBits[p] > 0) { 
+      end = off + (size_t)ml->numBits[p]; 
+      if (end > L || markBit <= end) 
+        return 0; 
+    } else { 
+      if (off >= L) 
+        return 0; 
+      if (markBit != none) { 
+        if (lastPacket) 
+          return 0; 
+        end = markBit; 
+        mark = findMark(stream->mseo, mark + 1, last); 
+        markBit = (mark < last) ? (mark - first + 1) * mdoBits : none; 
+      } else { 
+        if (!lastPacket) 
+          return 0; 
+        end = L; 
+      } 
+    } 
+    msg->start[p] = off; 
+    msg->numBits[p] = end - off; 
+    off = end; 
+  } 
+  return markBit == none && L - off < (size_t)mdoBits; 
+} 
+ 
+nxt_Status nx_DecodeAux (const nxt_PacketLayout *layout, 
+                         nxt_AuxStream *stream, nxt_MessageArena *arena) 
+{ 
+  if (!validMdoBits(stream->mdoBits)) 
+    return NX_ERROR_FAILED; 
+ 
+  for (;;) { 
+    size_t first = stream->pos; 
+    int bad; 
+    size_t last = findEnd(stream->mseo, first, stream->numTransfers, &bad); 
+    size_t bytes = 0; 
+    fastMessage msg; 
+    nxt_Message *m; 
+    int p; 
+ 
+    if (last >= stream->numTransfers) 
+      return NX_ERROR_NONE; 
+ 
+    if (bad || !fastParse(layout, stream, first, last, &msg)) { 
+      stream->numMalformed++; 
+      stream->pos = last + 1; 
+      continue; 
+    } 
+ 
+    for (p = 0; p < msg.numPackets; p++) 
+      bytes += NX_BYTES_IN_BITS(msg.numBits[p]); 
+    if (arena->numMessages >= arena->maxMessages || 
+        msg.numPackets > arena->maxPackets - arena->numPackets || 
+        bytes > arena->maxData - arena->numData) 
+      return NX_ERROR_NO_SPACE; 
+ 
+    m = &arena->messages[arena->numMessages++]; 
+    m->numPackets = msg.numPackets; 
+    m->packets = &arena->packets[arena->numPackets]; 
+    arena->numPackets += msg.numPackets; 
+    for (p = 0; p < msg.numPackets; p++) { 
+      unsigned char *data = &arena->data[arena->numData]; 
+ 
+      getBits(stream->mdo + first, stream->mdoBits, 
+              msg.start[p], msg.numBits[p], data); 
+      m->packets[p].numBitsInPacket = (int)msg.numBits[p]; 
+      m->packets[p].data = data; 
+      arena->numData += NX_BYTES_IN_BITS(msg.numBits[p]); 
+    } 
+    stream->pos = last + 1; 
+  } 
+} 
+ 
+ 
+/* +---------------------+ 
+   | AUX encoder         | 
+   +---------------------+ */ 
+ 
+/* nxt_BitWriter: MDO transfers being filled from an accumulator 
+*/ 
+typedef struct { 
+  unsigned short *mdo; 
+  int mdoBits; 
+  unsigned mask; 
+  size_t t; 
+  unsigned long long acc; 
+  int accBits; 
+} nxt_BitWriter; 
+ 
+static void putBits (nxt_BitWriter *w, const unsigned char *data, size_t n) 
+{ 
+  size_t i; 
+ 
+  for (i = 0; i < n; i += 8) { 
+    size_t nb = (n - i < 8) ? n - i : 8; 
+ 
+    w->acc |= (unsigned long long)(data[i / 8] & ((1u << nb) - 1)) 
+              << w->accBits; 
+    w->accBits += (int)nb; 
+    while (w->accBits >= w->mdoBits) { 
+      w->mdo[w->t++] = (unsigned short)(w->acc & w->mask); 
+      w->acc >>= w->mdoBits; 
+      w->accBits -= w->mdoBits; 
+    } 
+  } 
+} 
+ 
+static void padBits (nxt_BitWriter *w) 
+{ 
+  if (w->accBits > 0) { 
+    w->mdo[w->t++] = (unsigned short)(w->acc & w->mask); 
+    w->acc = 0; 
+    w->accBits = 0; 
+  } 
+} 
+ 
+nxt_Status nx_EncodeAux (const nxt_PacketLayout *layout, 
+                         const nxt_Message *messages, const int numMessages, 
+                         nxt_AuxBuffer *buffer, int *numEncoded) 
+{ 
+  const int mdoBits = buffer->mdoBits; 
+  int m; 
+ 
+  *numEncoded = 0; 
+  if (!validMdoBits(mdoBits)) 
+    return NX_ERROR_FAILED; 
+ 
+  for (m = 0; m < numMessages; m++) { 
+    const nxt_Message *msg = &messages[m]; 
+    const nxt_MessageLayout *ml; 
+    nxt_BitWriter w; 
+    size_t bits = 0; 
+    size_t first = buffer->numTransfers; 
+    size_t numTransfers; 
+    int p; 
+ 
+    /* check the message and size it */ 
+    if (msg->numPackets < 1 || 
+        msg->packets[0].numBitsInPacket != NX_TCODE_BITS) 
+      return NX_ERROR_FAILED; 
+    ml = &layout->tcode[((const unsigned char *)msg->packets[0].data)[0] & 
+                        (NX_NUM_TCODES - 1)]; 
+    if (ml->numPackets != msg->numPackets || ml->numPackets > NX_MAX_PACKETS) 
+      return NX_ERROR_FAILED; 
+    for (p = 0; p < msg->numPackets; p++) { 
+      int n = msg->packets[p].numBitsInPacket; 
+ 
+      if (n < 1 || (p > 0 && ml->numBits[p] != 0 && n != ml->numBits[p])) 
+        return NX_ERROR_FAILED; 
+      bits += (size_t)n; 
+      if (p > 0 && ml->numBits[p] == 0) 
+        bits = (bits + mdoBits - 1) / mdoBits * mdoBits; 
+    } 
+    numTransfers = (bits + mdoBits - 1) / mdoBits; 
+    if (numTransfers > buffer->maxTransfers - first) 
+      return NX_ERROR_NO_SPACE; 
+ 
+    memset(buffer->mseo + first, NX_MSEO_NORMAL, numTransfers); 
+    w.mdo = buffer->mdo; 
+    w.mdoBits = mdoBits; 
+    w.mask = (1u << mdoBits) - 1; 
+    w.t = first; 
+    w.acc = 0; 
+    w.accBits = 0; 
+    for (p = 0; p < msg->numPackets; p++) { 
+      putBits(&w, (const unsigned char *)msg->packets[p].data, 
+              (size_t)msg->packets[p].numBitsInPacket); 
+      if (p > 0 && ml->numBits[p] == 0) { 
+        padBits(&w); 
+        if (p < msg->numPackets - 1) 
+          buffer->mseo[w.t - 1] = NX_MSEO_END_PACKET; 
+      } 
+    } 
+    padBits(&w); 
+    buffer->mseo[first + numTransfers - 1] = NX_MSEO_END_MESSAGE; 
+    buffer->numTransfers += numTransfers; 
+    (*numEncoded)++; 
+  } 
+  return NX_ERROR_NONE; 
+} 
+ 
+ 
+/* +---------------------+ 
+   | NRR images          | 
+   +---------------------+ */ 
+ 
+static unsigned long long fieldMask (int width) 
+{ 
+  return (width >= 64) ? ~0ULL : ((1ULL << width) - 1); 
+} 
+ 
+void nx_PackNRR (const nxvt_Word *fields, const int *widths, 
+                 const int numFields, void *data) 
+{ 
+  unsigned char *out = (unsigned char *)data; 
+  unsigned long long acc = 0; 
+  int accBits = 0; 
+  int f; 
+  int i; 
+ 
+  for (f = 0; f < numFields; f++) { 
+    unsigned long long v = (unsigned long long)fields[f] & 
+                           fieldMask(widths[f]); 
+ 
+    acc |= v << accBits; 
+    if (accBits + widths[f] >= 64) { 
+      for (i = 0; i < 8; i++) 
+        *out++ = (unsigned char)(acc >> (8 * i)); 
+      acc = accBits ? v >> (64 - accBits) : 0; 
+      accBits += widths[f] - 64; 
+    } else { 
+      accBits += widths[f]; 
+    } 
+  } 
+  for (i = 0; i < accBits; i += 8) 
+    *out++ = (unsigned char)(acc >> i); 
+} 
+ 
+void nx_UnpackNRR (const void *data, const int *widths, 
+                   const int numFields, nxvt_Word *fields) 
+{ 
+  const unsigned char *in = (const unsigned char *)data; 
+  size_t total = 0; 
+  size_t numBytes; 
+  size_t bit = 0; 
+  int f; 
+ 
+  for (f = 0; f < numFields; f++) 
+    total += (size_t)widths[f]; 
+  numBytes = NX_BYTES_IN_BITS(total); 
+ 
+  for (f = 0; f < numFields; f++) { 
+    size_t b = bit / 8; 
+    int shift = (int)(bit % 8); 
+    unsigned long long v = 0; 
+    int i; 
+ 
+    /* the 8 bytes from b, then the ninth for a field reaching past them */ 
+    for (i = 0; i < 8 && b + i < numBytes; i++) 
+      v |= (unsigned long long)in[b + i] << (8 * i); 
+    v >>= shift; 
+    if (shift + widths[f] > 64) 
+      v |= (unsigned long long)in[b + 8] << (64 - shift); 
+    fields[f] = (nxvt_Word)(v & fieldMask(widths[f])); 
+    bit += (size_t)widths[f]; 
+  } 
+}
@@ -0,0 +1,329 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec_ref.c 
+ 
+  Synopsis: 
+    Scalar reference of the codecs of nxcodec.h: one bit, and one 
+    transfer, at a time, written to be obviously right rather than fast 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#include <string.h> 
+ 
+#include "nxcodec.h" 
+ 
+ 
+/* +---------------------+ 
+   | bit access          | 
+   +---------------------+ */ 
+ 
+static int getBit (const unsigned char *data, size_t i) 
+{ 
+  return (data[i / 8] >> (i % 8)) & 1; 
+} 
+ 
+static void putBit (unsigned char *data, size_t i, int bit) 
+{ 
+  if (bit) 
+    data[i / 8] |= (unsigned char)(1 << (i % 8)); 
+  else 
+    data[i / 8] &= (unsigned char)~(1 << (i % 8)); 
+} 
+ 
+static int validMdoBits (int mdoBits) 
+{ 
+  switch (mdoBits) { 
+    case 1: case 2: case 4: case 6: case 8: case 12: case 16: 
+      return 1; 
+    default: 
+      return 0; 
+  } 
+} 
+ 
+ 
+/* +---------------------+ 
+   | AUX decoder         | 
+   +---------------------+ */ 
+ 
+/* refMessage: the packets of one message, as found by refParse 
+*/ 
+typedef struct { 
+  int numPackets; 
+  size_t start[NX_MAX_PACKETS];   /* first bit, from the message start */ 
+  size_t numBits[NX_MAX_PACKETS]; 
+} refMessage; 
+ 
+/* refParse: walk the transfers first..last (last being the message's 
+    NX_MSEO_END_MESSAGE transfer) one bit at a time, following the 
+    layout; returns 0 if the message is malformed 
+*/ 
+static int refParse (const nxt_PacketLayout *layout, 
+                     const nxt_AuxStream *stream, 
+                     size_t first, size_t last, refMessage *msg) 
+{ 
+  const nxt_MessageLayout *ml = NULL; 
+  size_t bit = 0;       /* bits seen so far */ 
+  size_t have = 0;      /* bits in the current packet */ 
+  int tcode = 0; 
+  int p = 0;            /* current packet */ 
+  int numPackets = 1;   /* until the TCODE is known */ 
+  size_t t; 
+  int k; 
+ 
+  msg->start[0] = 0; 
+  for (t = first; t <= last; t++) { 
+    int code = stream->mseo[t]; 
+ 
+    if (code != NX_MSEO_NORMAL && code != NX_MSEO_END_PACKET && 
+        code != NX_MSEO_END_MESSAGE) 
+      return 0; 
+ 
+    for (k = 0; k < stream->mdoBits; k++, bit++) { 
+      int width; 
+ 
+      if (p >= numPackets) 
+        continue;                            /* padding */ 
+      width = (p == 0) ? NX_TCODE_BITS : ml->numBits[p]; 
+      if (p == 0) 
+        tcode |= ((stream->mdo[t] >> k) & 1) << have; 
+      have++; 
+      if (width != 0 && have == (size_t)width) { 
+        msg->numBits[p] = have; 
+        if (p == 0) { 
+          ml = &layout->tcode[tcode]; 
+          if (ml->numPackets < 1 || ml->numPackets > NX_MAX_PACKETS) 
+            return 0; 
+          numPackets = ml->numPackets; 
+        } 
+        p++; 
+        have = 0; 
+        if (p < numPackets) 
+          msg->start[p] = bit + 1; 
+      } 
+    } 
+ 
+    if (code == NX_MSEO_NORMAL) { 
+      if (p >= numPackets) 
+        return 0;                            /* ended too early */ 
+    } else if (p < numPackets) { 
+      /* the current packet must be a variable length one, now ended */ 
+      if (p == 0 || ml->numBits[p] != 0 || have == 0) 
+        return 0; 
+      msg->numBits[p] = have; 
+      p++; 
+      have = 0; 
+      if (p < numPackets) 
+        msg->start[p] = bit; 
+      if (code == NX_MSEO_END_PACKET && p >= numPackets) 
+        return 0;                            /* last packet, wrong end */ 
+      if (code == NX_MSEO_END_MESSAGE && p < numPackets) 
+        return 0;                            /* packets missing */ 
+    } else if (code == NX_MSEO_END_PACKET) { 
+      return 0;                              /* no packet to end */ 
+    } 
+  } 
+  msg->numPackets = numPackets; 
+  return 1; 
+} 
+ 
+nxt_Status nx_DecodeAuxRef (const nxt_PacketLayout *layout, 
+                            nxt_AuxStream *stream, nxt_MessageArena *arena) 
+{ 
+  if (!validMdoBits(stream->mdoBits)) 
+    return NX_ERROR_FAILED; 
+ 
+  for (;;) { 
+    size_t first = stream->pos; 
+    size_t last = first; 
+    size_t bytes = 0; 
+    refMessage msg; 
+    nxt_Message *m; 
+    int p; 
+ 
+    while (last < stream->numTransfers && 
+           stream->mseo[last] != NX_MSEO_END_MESSAGE) 
+      last++; 
+    if (last >= stream->numTransfers) 
+      return NX_ERROR_NONE;                  /* partial, or nothing left */ 
+ 
+    if (!refParse(layout, stream, first, last, &msg)) { 
+      stream->numMalformed++; 
+      stream->pos = last + 1; 
+      continue; 
+    } 
+ 
+    for (p = 0; p < msg.numPackets; p++) 
+      bytes += NX_BYTES_IN_BITS(msg.numBits[p]); 
+    if (arena->numMessages >= arena->maxMessages || 
+        msg.numPackets > arena->maxPackets - arena->numPackets || 
+        bytes > arena->maxData - arena->numData) 
+      return NX_ERROR_NO_SPACE; 
+ 
+    m = &arena->messages[arena->numMessages++]; 
+    m->numPackets = msg.numPackets; 
+    m->packets = &arena->packets[arena->numPackets]; 
+    arena->numPackets += msg.numPackets; 
+    for (p = 0; p < msg.numPackets; p++) { 
+      unsigned char *data = &arena->data[arena->numData]; 
+      size_t n = msg.numBits[p]; 
+      size_t i; 
+ 
+      memset(data, 0, NX_BYTES_IN_BITS(n)); 
+      for (i = 0; i < n; i++) { 
+        size_t b = msg.start[p] + i; 
+        size_t t = first + b / stream->mdoBits; 
+ 
+        putBit(data, i, (stream->mdo[t] >> (b % stream->mdoBits)) & 1); 
+      } 
+      m->packets[p].numBitsInPacket = (int)n; 
+      m->packets[p].data = data; 
+      arena->numData += NX_BYTES_IN_BITS(n); 
+    } 
+    stream->pos = last + 1; 
+  } 
+} 
+ 
+ 
+/* +---------------------+ 
+   | AUX encoder         | 
+   +---------------------+ */ 
+ 
+/* refCheck: returns the number of bits of msg, padding included, and 
+    sets *layoutOut to its layout; returns 0 if msg does not match it 
+*/ 
+static size_t refCheck (const nxt_PacketLayout *layout, 
+                        const nxt_Message *msg, const int mdoBits, 
+                        const nxt_MessageLayout **layoutOut) 
+{ 
+  const nxt_MessageLayout *ml; 
+  size_t bits = 0; 
+  int tcode = 0; 
+  int p; 
+  int i; 
+ 
+  if (msg->numPackets < 1 || 
+      msg->packets[0].numBitsInPacket != NX_TCODE_BITS) 
+    return 0; 
+  for (i = 0; i < NX_TCODE_BITS; i++) 
+    tcode |= getBit(msg->packets[0].data, i) << i; 
+  ml = &layout->tcode[tcode]; 
+  if (ml->numPackets != msg->numPackets || ml->numPackets > NX_MAX_PACKETS) 
+    return 0; 
+  *layoutOut = ml; 
+  for (p = 0; p < msg->numPackets; p++) { 
+    int n = msg->packets[p].numBitsInPacket; 
+ 
+    if (p > 0 && ml->numBits[p] != 0 && n != ml->numBits[p]) 
+      return 0; 
+    if (n < 1) 
+      return 0; 
+    bits += (size_t)n; 
+    if (p > 0 && ml->numBits[p] == 0) 
+      bits += (mdoBits - bits % mdoBits) % mdoBits; 
+  } 
+  return bits + (mdoBits - bits % mdoBits) % mdoBits; 
+} 
+ 
+nxt_Status nx_EncodeAuxRef (const nxt_PacketLayout *layout, 
+                            const nxt_Message *messages, 
+                            const int numMessages, 
+                            nxt_AuxBuffer *buffer, int *numEncoded) 
+{ 
+  const int mdoBits = buffer->mdoBits; 
+  int m; 
+ 
+  *numEncoded = 0; 
+  if (!validMdoBits(mdoBits)) 
+    return NX_ERROR_FAILED; 
+ 
+  for (m = 0; m < numMessages; m++) { 
+    const nxt_Message *msg = &messages[m]; 
+    const nxt_MessageLayout *ml; 
+    size_t bits = refCheck(layout, msg, mdoBits, &ml); 
+    size_t first = buffer->numTransfers; 
+    size_t numTransfers; 
+    size_t bit = 0; 
+    size_t t; 
+    int p; 
+ 
+    if (bits == 0) 
+      return NX_ERROR_FAILED; 
+    numTransfers = bits / mdoBits; 
+    if (numTransfers > buffer->maxTransfers - first) 
+      return NX_ERROR_NO_SPACE; 
+ 
+    for (t = first; t < first + numTransfers; t++) { 
+      buffer->mdo[t] = 0; 
+      buffer->mseo[t] = NX_MSEO_NORMAL; 
+    } 
+    for (p = 0; p < msg->numPackets; p++) { 
+      int n = msg->packets[p].numBitsInPacket; 
+      int i; 
+ 
+      for (i = 0; i < n; i++, bit++) { 
+        if (getBit(msg->packets[p].data, i)) 
+          buffer->mdo[first + bit / mdoBits] |= 
+            (unsigned short)(1u << (bit % mdoBits)); 
+      } 
+      if (p > 0 && ml->numBits[p] == 0) { 
+        bit += (mdoBits - bit % mdoBits) % mdoBits; 
+        if (p < msg->numPackets - 1) 
+          buffer->mseo[first + bit / mdoBits - 1] = NX_MSEO_END_PACKET; 
+      } 
+    } 
+    buffer->mseo[first + numTransfers - 1] = NX_MSEO_END_MESSAGE; 
+    buffer->numTransfers += numTransfers; 
+    (*numEncoded)++; 
+  } 
+  return NX_ERROR_NONE; 
+} 
+ 
+ 
+/* +---------------------+ 
+   | NRR images          | 
+   +---------------------+ */ 
+ 
+void nx_PackNRRRef (const nxvt_Word *fields, const int *widths, 
+                    const int numFields, void *data) 
+{ 
+  unsigned char *bytes = (unsigned char *)data; 
+  size_t bit = 0; 
+  int f; 
+  int i; 
+ 
+  for (f = 0; f < numFields; f++) { 
+    unsigned long long v = (unsigned long long)fields[f]; 
+ 
+    for (i = 0; i < widths[f]; i++, bit++) 
+      putBit(bytes, bit, (int)((v >> i) & 1)); 
+  } 
+  if (bit % 8) 
+    bytes[bit / 8] &= (unsigned char)((1 << (bit % 8)) - 1); 
+} 
+ 
+void nx_UnpackNRRRef (const void *data, const int *widths, 
+                      const int numFields, nxvt_Word *fields) 
+{ 
+  const unsigned char *bytes = (const unsigned char *)data; 
+  size_t bit = 0; 
+  int f; 
+  int i; 
+ 
+  for (f = 0; f < numFields; f++) { 
+    unsigned long long v = 0; 
+ 
+    for (i = 0; i < widths[f]; i++, bit++) 
+      v |= (unsigned long long)getBit(bytes, bit) << i; 
+    fields[f] = (nxvt_Word)v; 
+  } 
+}
@@ -0,0 +1,122 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec_bench.c 
+ 
+  Synopsis: 
+    Throughput gate for nxcodec.h: decodes the same AUX stream with the 
+    optimised codec and the scalar reference, and fails unless the 
+    optimised codec is at least a given factor faster and, if asked, a 
+    given number of MB/s of transfers fast 
+ 
+    Usage: nxcodec_bench [min-speedup [min-MB/s]] 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include <time.h> 
+ 
+#include "nxcodec_util.h" 
+ 
+ 
+/* NUM_MESSAGES: messages in the stream, MDO_BITS: its port width, 
+   MIN_SECONDS: time each codec is run for 
+*/ 
+#define NUM_MESSAGES (20000) 
+#define MDO_BITS (8) 
+#define MIN_SECONDS (0.25) 
+ 
+typedef nxt_Status (*decoder) (const nxt_PacketLayout *layout, 
+                               nxt_AuxStream *stream, 
+                               nxt_MessageArena *arena); 
+ 
+/* decodeRate: MB/s of MDO and MSEO bytes decoded; best of several runs, 
+    so a busy machine does not fail the gate 
+*/ 
+static double decodeRate (decoder decode, const nxt_PacketLayout *layout, 
+                          const nxt_AuxBuffer *b, nxt_MessageArena *arena) 
+{ 
+  double bytes = (double)b->numTransfers * 3; 
+  double best = 0; 
+  int run; 
+ 
+  for (run = 0; run < 5; run++) { 
+    clock_t start = clock(); 
+    double seconds; 
+    long n = 0; 
+ 
+    do { 
+      nxt_AuxStream stream; 
+ 
+      memset(&stream, 0, sizeof(stream)); 
+      stream.mdoBits = b->mdoBits; 
+      stream.mdo = b->mdo; 
+      stream.mseo = b->mseo; 
+      stream.numTransfers = b->numTransfers; 
+      nxt_ClearArena(arena); 
+      NXT_CHECK(decode(layout, &stream, arena) == NX_ERROR_NONE); 
+      NXT_CHECK(arena->numMessages == NUM_MESSAGES); 
+      n++; 
+      seconds = (double)(clock() - start) / CLOCKS_PER_SEC; 
+    } while (seconds < MIN_SECONDS / 5); 
+    if (bytes * n / seconds / 1e6 > best) 
+      best = bytes * n / seconds / 1e6; 
+  } 
+  return best; 
+} 
+ 
+int main (int argc, char **argv) 
+{ 
+  double minSpeedup = (argc > 1) ? atof(argv[1]) : 1.0; 
+  double minRate = (argc > 2) ? atof(argv[2]) : 0.0; 
+  nxt_PacketLayout layout; 
+  nxt_Rng rng; 
+  nxt_Messages msgs; 
+  nxt_AuxBuffer b; 
+  nxt_MessageArena arena; 
+  double fast; 
+  double ref; 
+  int numEncoded; 
+ 
+  nxt_SampleLayout(&layout); 
+  nxt_Seed(&rng, 5001); 
+  nxt_MakeMessages(&rng, &layout, NUM_MESSAGES, &msgs); 
+  b.mdoBits = MDO_BITS; 
+  b.maxTransfers = (size_t)NUM_MESSAGES * 256; 
+  b.numTransfers = 0; 
+  b.mdo = malloc(sizeof(unsigned short) * b.maxTransfers); 
+  b.mseo = malloc(b.maxTransfers); 
+  NXT_CHECK(b.mdo && b.mseo); 
+  NXT_CHECK(nx_EncodeAux(&layout, msgs.messages, NUM_MESSAGES, &b, 
+                         &numEncoded) == NX_ERROR_NONE); 
+  nxt_NewArena(&arena, NUM_MESSAGES, NUM_MESSAGES * NX_MAX_PACKETS, 
+               (size_t)NUM_MESSAGES * NX_MAX_PACKETS * 32); 
+ 
+  ref = decodeRate(nx_DecodeAuxRef, &layout, &b, &arena); 
+  fast = decodeRate(nx_DecodeAux, &layout, &b, &arena); 
+  printf("nxcodec_bench: %lu transfers, ref %.1f MB/s, fast %.1f MB/s, " 
+         "speedup %.2f (need %.2f, %.1f MB/s)\n", 
+         (unsigned long)b.numTransfers, ref, fast, fast / ref, 
+         minSpeedup, minRate); 
+ 
+  nxt_FreeArena(&arena); 
+  free(b.mdo); 
+  free(b.mseo); 
+  nxt_FreeMessages(&msgs); 
+  if (fast < ref * minSpeedup || fast < minRate) { 
+    fprintf(stderr, "nxcodec_bench: below the throughput gate\n"); 
+    return 1; 
+  } 
+  return 0; 
+}
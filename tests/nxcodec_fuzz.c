@@ -0,0 +1,245 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec_fuzz.c 
+ 
+  Synopsis: 
+    libFuzzer target for nxcodec.h: any input is decoded as an AUX stream 
+    and as an NRR image by the optimised codec and by the scalar 
+    reference, which must agree.  Built without libFuzzer, main() runs 
+    the target on the files named on the command line or, given none, 
+    on a fixed number of generated inputs, so ctest runs it too. 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+ 
+#include "nxcodec_util.h" 
+ 
+ 
+/* Input format: 
+    - byte 0: port width, as an index into nxt_MdoWidths, and in bit 7 
+        whether the rest of the input is a stream (0) or seeds a set of 
+        valid messages whose encoding the rest then corrupts (1) 
+    - byte 1: arena size 
+    - then 3 bytes per transfer: MDO low and high byte, and MSEO, taken 
+        modulo 4 unless it is 0xf0 or above, so that codes which are not 
+        an nxt_MSEO are seen too 
+   The same bytes then serve as an NRR image with field widths taken 
+   from them. 
+*/ 
+ 
+static nxt_PacketLayout layout; 
+ 
+static void decodeAll (const nxt_AuxStream *stream, int arenaSize) 
+{ 
+  nxt_AuxStream sf = *stream; 
+  nxt_AuxStream sr = *stream; 
+  nxt_MessageArena fast; 
+  nxt_MessageArena ref; 
+ 
+  nxt_NewArena(&fast, 1 + arenaSize % 16, NX_MAX_PACKETS + arenaSize, 
+               64 + 8 * (size_t)arenaSize); 
+  nxt_NewArena(&ref, 1 + arenaSize % 16, NX_MAX_PACKETS + arenaSize, 
+               64 + 8 * (size_t)arenaSize); 
+  for (;;) { 
+    nxt_Status stf = nx_DecodeAux(&layout, &sf, &fast); 
+    nxt_Status str = nx_DecodeAuxRef(&layout, &sr, &ref); 
+ 
+    NXT_CHECK(stf == str); 
+    NXT_CHECK(sf.pos == sr.pos); 
+    NXT_CHECK(sf.numMalformed == sr.numMalformed); 
+    nxt_SameArena(&fast, &ref); 
+    if (stf != NX_ERROR_NO_SPACE || fast.numMessages == 0) 
+      break; 
+    nxt_ClearArena(&fast); 
+    nxt_ClearArena(&ref); 
+  } 
+  nxt_FreeArena(&fast); 
+  nxt_FreeArena(&ref); 
+} 
+ 
+static void fuzzStream (const unsigned char *in, size_t size, int mdoBits, 
+                        int arenaSize) 
+{ 
+  size_t n = size / 3; 
+  unsigned short *mdo = malloc(sizeof(unsigned short) * (n + 1)); 
+  unsigned char *mseo = malloc(n + 1); 
+  nxt_AuxStream stream; 
+  size_t t; 
+ 
+  NXT_CHECK(mdo && mseo); 
+  for (t = 0; t < n; t++) { 
+    mdo[t] = (unsigned short)(in[3 * t] | (in[3 * t + 1] << 8)); 
+    mseo[t] = (unsigned char)(in[3 * t + 2] >= 0xf0 ? in[3 * t + 2] : 
+                              in[3 * t + 2] % 4); 
+  } 
+  memset(&stream, 0, sizeof(stream)); 
+  stream.mdoBits = mdoBits; 
+  stream.mdo = mdo; 
+  stream.mseo = mseo; 
+  stream.numTransfers = n; 
+  decodeAll(&stream, arenaSize); 
+  free(mdo); 
+  free(mseo); 
+} 
+ 
+static void fuzzEncoded (const unsigned char *in, size_t size, int mdoBits, 
+                         int arenaSize) 
+{ 
+  nxt_Rng rng; 
+  nxt_Messages msgs; 
+  nxt_AuxBuffer buf; 
+  nxt_AuxStream stream; 
+  unsigned long long seed = 0; 
+  int numMessages; 
+  int numEncoded; 
+  size_t i; 
+ 
+  for (i = 0; i < size && i < 8; i++) 
+    seed = (seed << 8) | in[i]; 
+  nxt_Seed(&rng, seed); 
+  numMessages = 1 + (int)(seed % 32); 
+  nxt_MakeMessages(&rng, &layout, numMessages, &msgs); 
+  buf.mdoBits = mdoBits; 
+  buf.maxTransfers = (size_t)numMessages * 1024; 
+  buf.numTransfers = 0; 
+  buf.mdo = malloc(sizeof(unsigned short) * buf.maxTransfers); 
+  buf.mseo = malloc(buf.maxTransfers); 
+  NXT_CHECK(buf.mdo && buf.mseo); 
+  NXT_CHECK(nx_EncodeAux(&layout, msgs.messages, numMessages, &buf, 
+                         &numEncoded) == NX_ERROR_NONE); 
+ 
+  /* each further 3 bytes pick a transfer and corrupt it */ 
+  for (i = 8; i + 3 <= size; i += 3) { 
+    size_t t = ((size_t)in[i] | ((size_t)in[i + 1] << 8)) % buf.numTransfers; 
+ 
+    if (in[i + 2] & 0x80) 
+      buf.mseo[t] = (unsigned char)(in[i + 2] & 0x3); 
+    else 
+      buf.mdo[t] ^= (unsigned short)(1u << (in[i + 2] % mdoBits)); 
+  } 
+  memset(&stream, 0, sizeof(stream)); 
+  stream.mdoBits = mdoBits; 
+  stream.mdo = buf.mdo; 
+  stream.mseo = buf.mseo; 
+  stream.numTransfers = buf.numTransfers; 
+  decodeAll(&stream, arenaSize); 
+  free(buf.mdo); 
+  free(buf.mseo); 
+  nxt_FreeMessages(&msgs); 
+} 
+ 
+static void fuzzNRR (const unsigned char *in, size_t size) 
+{ 
+  int widths[64]; 
+  nxvt_Word fast[64]; 
+  nxvt_Word ref[64]; 
+  unsigned char image[520]; 
+  unsigned char imageRef[520]; 
+  int numFields = 0; 
+  int total = 0; 
+  size_t i; 
+ 
+  for (i = 0; i < size && numFields < 64; i++) { 
+    widths[numFields] = 1 + in[i] % 64; 
+    total += widths[numFields++]; 
+  } 
+  if (numFields == 0) 
+    return; 
+  memset(image, 0, sizeof(image)); 
+  for (i = 0; i < (size_t)NX_BYTES_IN_BITS(total); i++) 
+    image[i] = in[i % size]; 
+  nx_UnpackNRR(image, widths, numFields, fast); 
+  nx_UnpackNRRRef(image, widths, numFields, ref); 
+  NXT_CHECK(memcmp(fast, ref, sizeof(nxvt_Word) * (size_t)numFields) == 0); 
+  nx_PackNRR(fast, widths, numFields, imageRef); 
+  NXT_CHECK(nxt_SameBits(image, imageRef, (size_t)total)); 
+  nx_PackNRRRef(ref, widths, numFields, image); 
+  NXT_CHECK(memcmp(image, imageRef, NX_BYTES_IN_BITS(total)) == 0); 
+} 
+ 
+int LLVMFuzzerTestOneInput (const unsigned char *in, size_t size) 
+{ 
+  int mdoBits; 
+ 
+  if (layout.tcode[1].numPackets == 0) 
+    nxt_SampleLayout(&layout); 
+  if (size < 2) 
+    return 0; 
+  mdoBits = nxt_MdoWidths[(in[0] & 0x7f) % 7]; 
+  if (in[0] & 0x80) 
+    fuzzEncoded(in + 2, size - 2, mdoBits, in[1]); 
+  else 
+    fuzzStream(in + 2, size - 2, mdoBits, in[1]); 
+  fuzzNRR(in, size); 
+  return 0; 
+} 
+ 
+ 
+#if !defined(NXCODEC_LIBFUZZER) 
+ 
+/* RUNS: generated inputs when no files are given 
+*/ 
+#define RUNS (20000) 
+ 
+static void runFile (const char *path) 
+{ 
+  FILE *f = fopen(path, "rb"); 
+  unsigned char *in; 
+  long size; 
+ 
+  NXT_CHECK(f != NULL); 
+  fseek(f, 0, SEEK_END); 
+  size = ftell(f); 
+  fseek(f, 0, SEEK_SET); 
+  in = malloc((size_t)size + 1); 
+  NXT_CHECK(in && fread(in, 1, (size_t)size, f) == (size_t)size); 
+  fclose(f); 
+  LLVMFuzzerTestOneInput(in, (size_t)size); 
+  free(in); 
+} 
+ 
+int main (int argc, char **argv) 
+{ 
+  unsigned char in[4096]; 
+  nxt_Rng rng; 
+  int i; 
+ 
+  if (argc > 1) { 
+    for (i = 1; i < argc; i++) 
+      runFile(argv[i]); 
+    printf("nxcodec_fuzz: %d inputs ok\n", argc - 1); 
+    return 0; 
+  } 
+  nxt_Seed(&rng, 5001); 
+  for (i = 0; i < RUNS; i++) { 
+    size_t size = 2 + (size_t)nxt_Below(&rng, (int)sizeof(in) - 2); 
+    size_t k; 
+ 
+    for (k = 0; k < size; k++) 
+      in[k] = (unsigned char)nxt_Next(&rng); 
+    /* streams of random bytes are nearly all malformed; bias the MSEO 
+       bytes of half of them towards NORMAL so that messages parse */ 
+    if (i % 2 && !(in[0] & 0x80)) 
+      for (k = 4; k < size; k += 3) 
+        if (nxt_Below(&rng, 8)) 
+          in[k] = (unsigned char)(nxt_Below(&rng, 6) ? 0 : 1); 
+    LLVMFuzzerTestOneInput(in, size); 
+  } 
+  printf("nxcodec_fuzz: %d generated inputs ok\n", RUNS); 
+  return 0; 
+} 
+ 
+#endif
@@ -0,0 +1,357 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec_roundtrip.c 
+ 
+  Synopsis: 
+    Property test of nxcodec.h: random messages and NRR images are round 
+    tripped through the encoders and decoders, and at every step the 
+    optimised codec is checked against the scalar reference 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+ 
+#include "nxcodec_util.h" 
+ 
+ 
+/* ROUNDS: message sets per port width, NRR_ROUNDS: NRR images 
+*/ 
+#define ROUNDS (200) 
+#define NRR_ROUNDS (20000) 
+ 
+ 
+/* +---------------------+ 
+   | AUX helpers         | 
+   +---------------------+ */ 
+ 
+typedef struct { 
+  nxt_AuxBuffer fast; 
+  nxt_AuxBuffer ref; 
+} encoded; 
+ 
+static void newBuffer (nxt_AuxBuffer *b, int mdoBits, size_t maxTransfers) 
+{ 
+  b->mdoBits = mdoBits; 
+  b->mdo = malloc(sizeof(unsigned short) * (maxTransfers + 1)); 
+  b->mseo = malloc(maxTransfers + 1); 
+  NXT_CHECK(b->mdo && b->mseo); 
+  b->maxTransfers = maxTransfers; 
+  b->numTransfers = 0; 
+} 
+ 
+static void freeBuffer (nxt_AuxBuffer *b) 
+{ 
+  free(b->mdo); 
+  free(b->mseo); 
+} 
+ 
+/* encodeBoth: encode with both codecs and check they agree; returns the 
+    status 
+*/ 
+static nxt_Status encodeBoth (const nxt_PacketLayout *layout, 
+                              const nxt_Message *messages, int numMessages, 
+                              encoded *e) 
+{ 
+  int numFast; 
+  int numRef; 
+  nxt_Status fast = nx_EncodeAux(layout, messages, numMessages, 
+                                 &e->fast, &numFast); 
+  nxt_Status ref = nx_EncodeAuxRef(layout, messages, numMessages, 
+                                   &e->ref, &numRef); 
+ 
+  NXT_CHECK(fast == ref); 
+  NXT_CHECK(numFast == numRef); 
+  NXT_CHECK(e->fast.numTransfers == e->ref.numTransfers); 
+  NXT_CHECK(memcmp(e->fast.mdo, e->ref.mdo, 
+                   sizeof(unsigned short) * e->fast.numTransfers) == 0); 
+  NXT_CHECK(memcmp(e->fast.mseo, e->ref.mseo, e->fast.numTransfers) == 0); 
+  return fast; 
+} 
+ 
+/* decodeBoth: decode numTransfers transfers from pos with both codecs 
+    and check they agree; returns the status 
+*/ 
+static nxt_Status decodeBoth (const nxt_PacketLayout *layout, 
+                              const nxt_AuxBuffer *b, size_t numTransfers, 
+                              size_t *pos, size_t *numMalformed, 
+                              nxt_MessageArena *fast, nxt_MessageArena *ref) 
+{ 
+  nxt_AuxStream sf; 
+  nxt_AuxStream sr; 
+  nxt_Status stf; 
+  nxt_Status str; 
+ 
+  sf.mdoBits = b->mdoBits; 
+  sf.mdo = b->mdo; 
+  sf.mseo = b->mseo; 
+  sf.numTransfers = numTransfers; 
+  sf.pos = *pos; 
+  sf.numMalformed = *numMalformed; 
+  sr = sf; 
+  stf = nx_DecodeAux(layout, &sf, fast); 
+  str = nx_DecodeAuxRef(layout, &sr, ref); 
+  NXT_CHECK(stf == str); 
+  NXT_CHECK(sf.pos == sr.pos); 
+  NXT_CHECK(sf.numMalformed == sr.numMalformed); 
+  nxt_SameArena(fast, ref); 
+  *pos = sf.pos; 
+  *numMalformed = sf.numMalformed; 
+  return stf; 
+} 
+ 
+/* checkDecoded: a decoded message against the one encoded 
+*/ 
+static void checkDecoded (const nxt_PacketLayout *layout, int mdoBits, 
+                          const nxt_Message *sent, const nxt_Message *got) 
+{ 
+  const unsigned char *tcode = (const unsigned char *)sent->packets[0].data; 
+  const nxt_MessageLayout *ml = &layout->tcode[tcode[0] & 0x3f]; 
+  int p; 
+ 
+  NXT_CHECK(got->numPackets == sent->numPackets); 
+  for (p = 0; p < sent->numPackets; p++) { 
+    const nxt_Packet *s = &sent->packets[p]; 
+    const nxt_Packet *g = &got->packets[p]; 
+    const unsigned char *gd = (const unsigned char *)g->data; 
+    int i; 
+ 
+    NXT_CHECK(nxt_SameBits(s->data, g->data, (size_t)s->numBitsInPacket)); 
+    if (p == 0 || ml->numBits[p] > 0) { 
+      NXT_CHECK(g->numBitsInPacket == s->numBitsInPacket); 
+    } else { 
+      NXT_CHECK(g->numBitsInPacket >= s->numBitsInPacket); 
+      NXT_CHECK(g->numBitsInPacket - s->numBitsInPacket < mdoBits); 
+      for (i = s->numBitsInPacket; i < g->numBitsInPacket; i++) 
+        NXT_CHECK(((gd[i / 8] >> (i % 8)) & 1) == 0); 
+    } 
+    if (g->numBitsInPacket % 8) 
+      NXT_CHECK((gd[g->numBitsInPacket / 8] >> 
+                 (g->numBitsInPacket % 8)) == 0); 
+  } 
+} 
+ 
+ 
+/* +---------------------+ 
+   | AUX properties      | 
+   +---------------------+ */ 
+ 
+static void checkAux (nxt_Rng *rng, const nxt_PacketLayout *layout, 
+                      int mdoBits) 
+{ 
+  int numMessages = 1 + nxt_Below(rng, 120); 
+  size_t maxTransfers = (size_t)numMessages * 1024; 
+  nxt_Messages msgs; 
+  encoded e; 
+  encoded again; 
+  nxt_MessageArena fast; 
+  nxt_MessageArena ref; 
+  size_t pos = 0; 
+  size_t bad = 0; 
+  size_t cut; 
+  int total; 
+  int m; 
+ 
+  nxt_MakeMessages(rng, layout, numMessages, &msgs); 
+  newBuffer(&e.fast, mdoBits, maxTransfers); 
+  newBuffer(&e.ref, mdoBits, maxTransfers); 
+  newBuffer(&again.fast, mdoBits, maxTransfers); 
+  newBuffer(&again.ref, mdoBits, maxTransfers); 
+  nxt_NewArena(&fast, numMessages, numMessages * NX_MAX_PACKETS, 
+               (size_t)numMessages * NX_MAX_PACKETS * 32); 
+  nxt_NewArena(&ref, numMessages, numMessages * NX_MAX_PACKETS, 
+               (size_t)numMessages * NX_MAX_PACKETS * 32); 
+ 
+  /* encode, decode, compare with what was sent */ 
+  NXT_CHECK(encodeBoth(layout, msgs.messages, numMessages, &e) == 
+            NX_ERROR_NONE); 
+  NXT_CHECK(decodeBoth(layout, &e.fast, e.fast.numTransfers, &pos, &bad, 
+                       &fast, &ref) == NX_ERROR_NONE); 
+  NXT_CHECK(pos == e.fast.numTransfers && bad == 0); 
+  NXT_CHECK(fast.numMessages == numMessages); 
+  for (m = 0; m < numMessages; m++) 
+    checkDecoded(layout, mdoBits, &msgs.messages[m], &fast.messages[m]); 
+ 
+  /* encoding what was decoded gives the same transfers */ 
+  NXT_CHECK(encodeBoth(layout, fast.messages, fast.numMessages, &again) == 
+            NX_ERROR_NONE); 
+  NXT_CHECK(again.fast.numTransfers == e.fast.numTransfers); 
+  NXT_CHECK(memcmp(again.fast.mdo, e.fast.mdo, 
+                   sizeof(unsigned short) * e.fast.numTransfers) == 0); 
+  NXT_CHECK(memcmp(again.fast.mseo, e.fast.mseo, e.fast.numTransfers) == 0); 
+ 
+  /* a cut stream leaves its partial message for the next call */ 
+  cut = (size_t)nxt_Below(rng, (int)e.fast.numTransfers + 1); 
+  pos = 0; 
+  nxt_ClearArena(&fast); 
+  nxt_ClearArena(&ref); 
+  NXT_CHECK(decodeBoth(layout, &e.fast, cut, &pos, &bad, &fast, &ref) == 
+            NX_ERROR_NONE); 
+  NXT_CHECK(pos <= cut); 
+  NXT_CHECK(decodeBoth(layout, &e.fast, e.fast.numTransfers, &pos, &bad, 
+                       &fast, &ref) == NX_ERROR_NONE); 
+  NXT_CHECK(fast.numMessages == numMessages && bad == 0); 
+ 
+  /* a small arena fills up and decoding resumes where it stopped */ 
+  nxt_FreeArena(&fast); 
+  nxt_FreeArena(&ref); 
+  { 
+    int maxMessages = 1 + nxt_Below(rng, 8); 
+    int maxPackets = NX_MAX_PACKETS + nxt_Below(rng, 32); 
+    size_t maxData = 256 + (size_t)nxt_Below(rng, 256); 
+ 
+    nxt_NewArena(&fast, maxMessages, maxPackets, maxData); 
+    nxt_NewArena(&ref, maxMessages, maxPackets, maxData); 
+  } 
+  pos = 0; 
+  total = 0; 
+  for (;;) { 
+    nxt_Status st = decodeBoth(layout, &e.fast, e.fast.numTransfers, 
+                               &pos, &bad, &fast, &ref); 
+ 
+    total += fast.numMessages; 
+    if (st == NX_ERROR_NONE) 
+      break; 
+    NXT_CHECK(st == NX_ERROR_NO_SPACE && fast.numMessages > 0); 
+    nxt_ClearArena(&fast); 
+    nxt_ClearArena(&ref); 
+  } 
+  NXT_CHECK(total == numMessages && bad == 0); 
+ 
+  /* corrupted transfers: both decoders skip the same messages */ 
+  { 
+    int flips = 1 + nxt_Below(rng, 8); 
+    int i; 
+ 
+    for (i = 0; i < flips; i++) { 
+      size_t t = (size_t)nxt_Below(rng, (int)e.fast.numTransfers); 
+ 
+      if (nxt_Below(rng, 2)) 
+        e.fast.mdo[t] ^= (unsigned short)(1u << nxt_Below(rng, mdoBits)); 
+      else 
+        e.fast.mseo[t] = (unsigned char)nxt_Below(rng, 5); 
+    } 
+    pos = 0; 
+    bad = 0; 
+    for (;;) { 
+      nxt_ClearArena(&fast); 
+      nxt_ClearArena(&ref); 
+      if (decodeBoth(layout, &e.fast, e.fast.numTransfers, &pos, &bad, 
+                     &fast, &ref) == NX_ERROR_NONE || 
+          fast.numMessages == 0) 
+        break;                 /* done, or merged past the arena's size */ 
+    } 
+  } 
+ 
+  /* the encoder stops at the first message that does not fit... */ 
+  again.fast.numTransfers = 0; 
+  again.ref.numTransfers = 0; 
+  again.fast.maxTransfers = (size_t)nxt_Below(rng, (int)e.ref.numTransfers); 
+  again.ref.maxTransfers = again.fast.maxTransfers; 
+  NXT_CHECK(encodeBoth(layout, msgs.messages, numMessages, &again) == 
+            NX_ERROR_NO_SPACE); 
+ 
+  /* ...or that does not match its layout */ 
+  again.fast.numTransfers = 0; 
+  again.ref.numTransfers = 0; 
+  again.fast.maxTransfers = maxTransfers; 
+  again.ref.maxTransfers = maxTransfers; 
+  m = nxt_Below(rng, numMessages); 
+  msgs.messages[m].packets[nxt_Below(rng, msgs.messages[m].numPackets)] 
+    .numBitsInPacket = 0; 
+  NXT_CHECK(encodeBoth(layout, msgs.messages, numMessages, &again) == 
+            NX_ERROR_FAILED); 
+ 
+  nxt_FreeArena(&fast); 
+  nxt_FreeArena(&ref); 
+  freeBuffer(&e.fast); 
+  freeBuffer(&e.ref); 
+  freeBuffer(&again.fast); 
+  freeBuffer(&again.ref); 
+  nxt_FreeMessages(&msgs); 
+} 
+ 
+ 
+/* +---------------------+ 
+   | NRR properties      | 
+   +---------------------+ */ 
+ 
+static void checkNRR (nxt_Rng *rng) 
+{ 
+  int widths[32]; 
+  nxvt_Word fields[32]; 
+  nxvt_Word fast[32]; 
+  nxvt_Word ref[32]; 
+  unsigned char image[260]; 
+  unsigned char imageRef[260]; 
+  int numFields = 1 + nxt_Below(rng, 32); 
+  int total = 0; 
+  int f; 
+ 
+  for (f = 0; f < numFields; f++) { 
+    widths[f] = nxt_Below(rng, 4) ? 1 + nxt_Below(rng, 64) : 64; 
+    fields[f] = (nxvt_Word)nxt_Next(rng); 
+    total += widths[f]; 
+  } 
+ 
+  /* pack: both agree, and unpacking gives the fields back */ 
+  memset(image, 0xa5, sizeof(image)); 
+  memset(imageRef, 0x5a, sizeof(imageRef)); 
+  nx_PackNRR(fields, widths, numFields, image); 
+  nx_PackNRRRef(fields, widths, numFields, imageRef); 
+  NXT_CHECK(memcmp(image, imageRef, NX_BYTES_IN_BITS(total)) == 0); 
+  nx_UnpackNRR(image, widths, numFields, fast); 
+  nx_UnpackNRRRef(image, widths, numFields, ref); 
+  for (f = 0; f < numFields; f++) { 
+    unsigned long long mask = (widths[f] == 64) ? ~0ULL : 
+                              (1ULL << widths[f]) - 1; 
+ 
+    NXT_CHECK(fast[f] == ref[f]); 
+    NXT_CHECK((unsigned long long)fast[f] == 
+              ((unsigned long long)fields[f] & mask)); 
+  } 
+ 
+  /* unpack any image, bits above the register included: both agree, 
+     and packing gives the image back */ 
+  for (f = 0; f < NX_BYTES_IN_BITS(total); f++) 
+    image[f] = (unsigned char)nxt_Next(rng); 
+  nx_UnpackNRR(image, widths, numFields, fast); 
+  nx_UnpackNRRRef(image, widths, numFields, ref); 
+  NXT_CHECK(memcmp(fast, ref, sizeof(nxvt_Word) * (size_t)numFields) == 0); 
+  nx_PackNRR(fast, widths, numFields, imageRef); 
+  NXT_CHECK(nxt_SameBits(image, imageRef, (size_t)total)); 
+  if (total % 8) 
+    NXT_CHECK((imageRef[total / 8] >> (total % 8)) == 0); 
+} 
+ 
+ 
+int main (int argc, char **argv) 
+{ 
+  nxt_PacketLayout layout; 
+  nxt_Rng rng; 
+  unsigned long long seed = (argc > 1) ? strtoul(argv[1], NULL, 0) : 1; 
+  int w; 
+  int i; 
+ 
+  nxt_SampleLayout(&layout); 
+  nxt_Seed(&rng, seed); 
+  for (w = 0; w < 7; w++) 
+    for (i = 0; i < ROUNDS; i++) 
+      checkAux(&rng, &layout, nxt_MdoWidths[w]); 
+  for (i = 0; i < NRR_ROUNDS; i++) 
+    checkNRR(&rng); 
+  printf("nxcodec_roundtrip: seed %llu, %d message sets, %d NRR images ok\n", 
+         seed, 7 * ROUNDS, NRR_ROUNDS); 
+  return 0; 
+}
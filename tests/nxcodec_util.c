@@ -0,0 +1,230 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec_util.c 
+ 
+  Synopsis: 
+    Helpers shared by the codec harness 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+ 
+#include "nxcodec_util.h" 
+ 
+ 
+void nxt_Fail (const char *what, const char *file, int line) 
+{ 
+  fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what); 
+  abort(); 
+} 
+ 
+ 
+/* +---------------------+ 
+   | random numbers      | 
+   +---------------------+ */ 
+ 
+void nxt_Seed (nxt_Rng *rng, unsigned long long seed) 
+{ 
+  rng->s = seed * 0x9e3779b97f4a7c15ULL + 1; 
+} 
+ 
+unsigned long long nxt_Next (nxt_Rng *rng) 
+{ 
+  rng->s ^= rng->s >> 12; 
+  rng->s ^= rng->s << 25; 
+  rng->s ^= rng->s >> 27; 
+  return rng->s * 0x2545f4914f6cdd1dULL; 
+} 
+ 
+int nxt_Below (nxt_Rng *rng, int n) 
+{ 
+  return (int)((nxt_Next(rng) >> 33) % (unsigned long long)n); 
+} 
+ 
+ 
+/* +---------------------+ 
+   | layouts & messages  | 
+   +---------------------+ */ 
+ 
+const int nxt_MdoWidths[7] = { 1, 2, 4, 6, 8, 12, 16 }; 
+ 
+static void setLayout (nxt_PacketLayout *layout, int tcode, 
+                       int numPackets, const int *numBits) 
+{ 
+  nxt_MessageLayout *ml = &layout->tcode[tcode]; 
+  int p; 
+ 
+  ml->numPackets = numPackets; 
+  ml->numBits[0] = NX_TCODE_BITS; 
+  for (p = 1; p < numPackets; p++) 
+    ml->numBits[p] = numBits[p - 1]; 
+} 
+ 
+void nxt_SampleLayout (nxt_PacketLayout *layout) 
+{ 
+  static const int deviceId[] = { 32 };              /* DID */ 
+  static const int ownership[] = { 0 };              /* process ID */ 
+  static const int directBranch[] = { 0 };           /* I-CNT */ 
+  static const int indirectBranch[] = { 0, 0 };      /* I-CNT, U-ADDR */ 
+  static const int dataTrace[] = { 4, 3, 0, 0 };     /* SRC, DSZ, ADDR, DATA */ 
+  static const int error[] = { 4, 5 };               /* SRC, ECODE */ 
+  static const int stamped[] = { 4, 0, 0, 0 };       /* ..., TSTAMP */ 
+  static const int mixed[] = { 0, 7, 0, 12 };        /* fixed after variable */ 
+  static const int wide[] = { 0, 64, 3 };            /* wide fixed packet */ 
+ 
+  memset(layout, 0, sizeof(*layout)); 
+  setLayout(layout, 1, 2, deviceId); 
+  setLayout(layout, 2, 2, ownership); 
+  setLayout(layout, 3, 2, directBranch); 
+  setLayout(layout, 4, 3, indirectBranch); 
+  setLayout(layout, 5, 5, dataTrace); 
+  setLayout(layout, 6, 5, dataTrace); 
+  setLayout(layout, 8, 3, error); 
+  setLayout(layout, 13, 5, dataTrace); 
+  setLayout(layout, 14, 5, dataTrace); 
+  setLayout(layout, 33, 5, stamped); 
+  setLayout(layout, 40, 5, mixed); 
+  setLayout(layout, 41, 4, wide); 
+  setLayout(layout, 63, 1, NULL);                    /* TCODE only */ 
+} 
+ 
+void nxt_MakeMessages (nxt_Rng *rng, const nxt_PacketLayout *layout, 
+                       int numMessages, nxt_Messages *out) 
+{ 
+  int used[NX_NUM_TCODES]; 
+  int numUsed = 0; 
+  size_t numData = 0; 
+  int numPackets = 0; 
+  int t; 
+  int m; 
+ 
+  for (t = 0; t < NX_NUM_TCODES; t++) 
+    if (layout->tcode[t].numPackets > 0) 
+      used[numUsed++] = t; 
+ 
+  out->numMessages = numMessages; 
+  out->messages = malloc(sizeof(nxt_Message) * (size_t)numMessages); 
+  out->packets = malloc(sizeof(nxt_Packet) * (size_t)numMessages * 
+                        NX_MAX_PACKETS); 
+  out->data = malloc((size_t)numMessages * NX_MAX_PACKETS * 16); 
+  NXT_CHECK(out->messages && out->packets && out->data); 
+ 
+  for (m = 0; m < numMessages; m++) { 
+    int tcode = used[nxt_Below(rng, numUsed)]; 
+    const nxt_MessageLayout *ml = &layout->tcode[tcode]; 
+    nxt_Message *msg = &out->messages[m]; 
+    int p; 
+ 
+    msg->numPackets = ml->numPackets; 
+    msg->packets = &out->packets[numPackets]; 
+    numPackets += ml->numPackets; 
+    for (p = 0; p < ml->numPackets; p++) { 
+      nxt_Packet *pkt = &msg->packets[p]; 
+      unsigned char *data = &out->data[numData]; 
+      int n; 
+      int i; 
+ 
+      if (p == 0) 
+        n = NX_TCODE_BITS; 
+      else if (ml->numBits[p] > 0) 
+        n = ml->numBits[p]; 
+      else 
+        n = 1 + nxt_Below(rng, nxt_Below(rng, 4) ? 40 : 120); 
+      for (i = 0; i < NX_BYTES_IN_BITS(n); i++) 
+        data[i] = (unsigned char)nxt_Next(rng); 
+      if (p == 0) 
+        data[0] = (unsigned char)((data[0] & ~0x3f) | tcode); 
+      pkt->numBitsInPacket = n; 
+      pkt->data = data; 
+      numData += (size_t)NX_BYTES_IN_BITS(n); 
+    } 
+  } 
+} 
+ 
+void nxt_FreeMessages (nxt_Messages *msgs) 
+{ 
+  free(msgs->messages); 
+  free(msgs->packets); 
+  free(msgs->data); 
+} 
+ 
+ 
+/* +---------------------+ 
+   | arenas              | 
+   +---------------------+ */ 
+ 
+void nxt_NewArena (nxt_MessageArena *arena, int maxMessages, 
+                   int maxPackets, size_t maxData) 
+{ 
+  arena->messages = malloc(sizeof(nxt_Message) * (size_t)(maxMessages + 1)); 
+  arena->packets = malloc(sizeof(nxt_Packet) * (size_t)(maxPackets + 1)); 
+  arena->data = malloc(maxData + 1); 
+  NXT_CHECK(arena->messages && arena->packets && arena->data); 
+  arena->maxMessages = maxMessages; 
+  arena->maxPackets = maxPackets; 
+  arena->maxData = maxData; 
+  nxt_ClearArena(arena); 
+} 
+ 
+void nxt_FreeArena (nxt_MessageArena *arena) 
+{ 
+  free(arena->messages); 
+  free(arena->packets); 
+  free(arena->data); 
+} 
+ 
+void nxt_ClearArena (nxt_MessageArena *arena) 
+{ 
+  arena->numMessages = 0; 
+  arena->numPackets = 0; 
+  arena->numData = 0; 
+} 
+ 
+void nxt_SameArena (const nxt_MessageArena *a, const nxt_MessageArena *b) 
+{ 
+  int m; 
+  int p; 
+ 
+  NXT_CHECK(a->numMessages == b->numMessages); 
+  NXT_CHECK(a->numPackets == b->numPackets); 
+  NXT_CHECK(a->numData == b->numData); 
+  NXT_CHECK(memcmp(a->data, b->data, a->numData) == 0); 
+  for (m = 0; m < a->numMessages; m++) { 
+    const nxt_Message *ma = &a->messages[m]; 
+    const nxt_Message *mb = &b->messages[m]; 
+ 
+    NXT_CHECK(ma->numPackets == mb->numPackets); 
+    NXT_CHECK(ma->packets - a->packets == mb->packets - b->packets); 
+    for (p = 0; p < ma->numPackets; p++) { 
+      NXT_CHECK(ma->packets[p].numBitsInPacket == 
+                mb->packets[p].numBitsInPacket); 
+      NXT_CHECK((unsigned char *)ma->packets[p].data - a->data == 
+                (unsigned char *)mb->packets[p].data - b->data); 
+    } 
+  } 
+} 
+ 
+int nxt_SameBits (const void *a, const void *b, size_t n) 
+{ 
+  const unsigned char *x = (const unsigned char *)a; 
+  const unsigned char *y = (const unsigned char *)b; 
+  size_t whole = n / 8; 
+ 
+  if (memcmp(x, y, whole) != 0) 
+    return 0; 
+  if (n % 8) 
+    return ((x[whole] ^ y[whole]) & ((1u << (n % 8)) - 1)) == 0; 
+  return 1; 
+}
@@ -0,0 +1,94 @@
+/******************************************************************************* 
+ 
+  IEEE-ISTO 5001(tm) - 1999, The Nexus 5001 Forum(tm) Standard for a Global 
+    Embedded Processor Debug Interface 
+  ---------------------------------------------------------------------------- 
+ 
+  This file is an extension to the IEEE-ISTO 5001(tm) - 1999 API V1.0. 
+ 
+  File: 
+    nxcodec_util.h 
+ 
+  Synopsis: 
+    Helpers shared by the codec harness: a sample packet layout, a 
+    seeded random generator, message generation and arena comparison 
+ 
+  History: 
+    19-Oct-2026 - originated 
+ 
+*******************************************************************************/ 
+ 
+#ifndef _nxcodec_util_h_ 
+#define _nxcodec_util_h_ 
+ 
+#include "nxcodec.h" 
+ 
+ 
+/* NXT_CHECK: report a failed check with its location and abort, so the 
+    fuzzer and ctest both see it 
+*/ 
+#define NXT_CHECK(c) ((c) ? (void)0 : nxt_Fail(#c, __FILE__, __LINE__)) 
+ 
+void nxt_Fail (const char *what, const char *file, int line); 
+ 
+ 
+/* nxt_Rng: xorshift64* generator, so every run of a test is repeatable 
+*/ 
+typedef struct { 
+  unsigned long long s; 
+} nxt_Rng; 
+ 
+void nxt_Seed (nxt_Rng *rng, unsigned long long seed); 
+unsigned long long nxt_Next (nxt_Rng *rng); 
+int nxt_Below (nxt_Rng *rng, int n); 
+ 
+ 
+/* nxt_MdoWidths: the port widths nxcodec.h allows 
+*/ 
+extern const int nxt_MdoWidths[7]; 
+ 
+ 
+/* nxt_SampleLayout: Appendix B style layouts for the TCODEs the tests 
+    use, with fixed and variable packets in every order; the others are 
+    unused 
+*/ 
+void nxt_SampleLayout (nxt_PacketLayout *layout); 
+ 
+ 
+/* nxt_Messages: room for a set of generated messages 
+*/ 
+typedef struct { 
+  nxt_Message *messages; 
+  nxt_Packet *packets; 
+  unsigned char *data; 
+  int numMessages; 
+} nxt_Messages; 
+ 
+/* nxt_MakeMessages: numMessages random messages matching layout; the 
+    bits of each packet's last byte above its width are random too, as 
+    the encoder must ignore them 
+*/ 
+void nxt_MakeMessages (nxt_Rng *rng, const nxt_PacketLayout *layout, 
+                       int numMessages, nxt_Messages *out); 
+ 
+void nxt_FreeMessages (nxt_Messages *msgs); 
+ 
+ 
+/* nxt_NewArena, nxt_FreeArena, nxt_ClearArena: arenas sized as given 
+*/ 
+void nxt_NewArena (nxt_MessageArena *arena, int maxMessages, 
+                   int maxPackets, size_t maxData); 
+void nxt_FreeArena (nxt_MessageArena *arena); 
+void nxt_ClearArena (nxt_MessageArena *arena); 
+ 
+/* nxt_SameArena: checks that two decoders filled a and b byte for byte 
+    the same, packet pointers compared as offsets into their arena 
+*/ 
+void nxt_SameArena (const nxt_MessageArena *a, const nxt_MessageArena *b); 
+ 
+ 
+/* nxt_SameBits: whether the first n bits of a and b are equal 
+*/ 
+int nxt_SameBits (const void *a, const void *b, size_t n); 
+ 
+#endif /* _nxcodec_util_h_ */